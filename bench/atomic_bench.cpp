@@ -0,0 +1,91 @@
+/**
+ * @file atomic_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares publishing a status Result through a mutex-guarded slot
+ *        with an AtomicResult, on a reporting workload where every thread
+ *        reads the status and writes it once every 16 operations.
+ * @version 0.1
+ * @date 2026-01-13
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include <mutex>
+
+#include "atomic_result.hh"
+#include "inspect.hh"
+
+namespace {
+
+enum class StatusError : std::uint8_t { TIMEOUT, CLOSED };
+
+using Status = adt::Result<std::uint32_t, StatusError>;
+
+Status next_status(std::uint32_t step) {
+  if (step % 64 == 0) {
+    return adt::Error(StatusError::TIMEOUT);
+  }
+  return adt::Ok(step);
+}
+
+std::uint32_t report(std::uint32_t progress) { return progress; }
+std::uint32_t report(StatusError) { return 0; }
+
+// --- Baseline: the slot as it is guarded today ---
+class LockedStatus {
+  mutable std::mutex _mutex;
+  Status _status = adt::Ok(0u);
+
+public:
+  Status load() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _status;
+  }
+  void store(const Status &status) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _status = status;
+  }
+};
+
+template <typename Read, typename Write>
+void run_reporting(benchmark::State &state, Read read, Write write) {
+  std::uint32_t step = static_cast<std::uint32_t>(state.thread_index()) << 20;
+  bench::run_measured(state, [&] {
+    if (++step % 16 == 0) {
+      write(next_status(step));
+    }
+    benchmark::DoNotOptimize(read());
+  });
+}
+
+void BM_StatusMutex(benchmark::State &state) {
+  static LockedStatus status;
+  run_reporting(
+      state,
+      [] {
+        return adt::Inspect(status.load(),
+                            [](const auto &value) { return report(value); });
+      },
+      [](const Status &next) { status.store(next); });
+}
+
+void BM_StatusAtomic(benchmark::State &state) {
+  static adt::AtomicResult<std::uint32_t, StatusError> status{
+      Status(adt::Ok(0u))};
+  run_reporting(
+      state,
+      [] {
+        return adt::Inspect(status,
+                            [](const auto &value) { return report(value); });
+      },
+      [](const Status &next) {
+        status.store(next, std::memory_order_release);
+      });
+}
+
+BENCHMARK(BM_StatusMutex)->Threads(1)->Threads(4);
+BENCHMARK(BM_StatusAtomic)->Threads(1)->Threads(4);
+
+} // namespace
@@ -0,0 +1,94 @@
+/**
+ * @file bench_support.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Implementation of the benchmark helpers, including the replacement
+ *        of the global operator new used to count allocations.
+ * @version 0.1
+ * @date 2026-01-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+thread_local std::uint64_t allocations = 0;
+} // namespace
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace bench {
+
+std::uint64_t allocation_count() noexcept { return allocations; }
+
+#if defined(__linux__)
+
+BranchMissCounter::BranchMissCounter() {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  _fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+BranchMissCounter::~BranchMissCounter() {
+  if (available()) {
+    close(_fd);
+  }
+}
+
+void BranchMissCounter::start() noexcept {
+  if (available()) {
+    ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+}
+
+std::uint64_t BranchMissCounter::stop() noexcept {
+  std::uint64_t count = 0;
+  if (available()) {
+    ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(_fd, &count, sizeof(count)) != sizeof(count)) {
+      count = 0;
+    }
+  }
+  return count;
+}
+
+#else
+
+BranchMissCounter::BranchMissCounter() = default;
+BranchMissCounter::~BranchMissCounter() = default;
+void BranchMissCounter::start() noexcept {}
+std::uint64_t BranchMissCounter::stop() noexcept { return 0; }
+
+#endif
+
+} // namespace bench
+
+BENCHMARK_MAIN();
@@ -0,0 +1,163 @@
+/**
+ * @file bench_support.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Shared helpers of the benchmark suite: hardware branch-miss counter,
+ *        global allocation counter and generators of N-alternative variants.
+ * @version 0.1
+ * @date 2026-01-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace bench {
+
+/**
+ * @brief Counts user-space branch misses of the calling thread through
+ *        perf_event_open. When the kernel refuses access (containers,
+ *        perf_event_paranoid), it is silently disabled.
+ */
+class BranchMissCounter {
+  int _fd = -1;
+
+public:
+  BranchMissCounter();
+  ~BranchMissCounter();
+  BranchMissCounter(const BranchMissCounter &) = delete;
+  BranchMissCounter &operator=(const BranchMissCounter &) = delete;
+
+  bool available() const noexcept { return _fd >= 0; }
+  void start() noexcept;
+  std::uint64_t stop() noexcept;
+};
+
+/**
+ * @brief Number of heap allocations made so far by this thread, counted by
+ *        the replaced global operator new.
+ */
+std::uint64_t allocation_count() noexcept;
+
+/**
+ * @brief Runs the timed loop of `state` and adds the branch-miss and
+ *        allocation counters (per iteration) of its body.
+ */
+template <typename Body>
+void run_measured(benchmark::State &state, Body &&body) {
+  BranchMissCounter misses;
+  const std::uint64_t allocations_before = allocation_count();
+
+  misses.start();
+  for (auto _ : state) {
+    body();
+  }
+  const std::uint64_t branch_misses = misses.stop();
+
+  if (misses.available()) {
+    state.counters["branch-misses/op"] = benchmark::Counter(
+        static_cast<double>(branch_misses), benchmark::Counter::kAvgIterations);
+  }
+  state.counters["allocs/op"] = benchmark::Counter(
+      static_cast<double>(allocation_count() - allocations_before),
+      benchmark::Counter::kAvgIterations);
+}
+
+// --- Payloads: trivially copyable and heap-owning alternatives ---
+template <std::size_t I> struct Trivial {
+  std::uint32_t value;
+};
+
+template <std::size_t I> struct Heap {
+  std::string value;
+};
+
+template <template <std::size_t> class Payload, std::size_t... Is>
+auto make_variant_type(std::index_sequence<Is...>)
+    -> std::variant<Payload<Is>...>;
+
+template <template <std::size_t> class Payload, std::size_t N>
+using VariantOf =
+    decltype(make_variant_type<Payload>(std::make_index_sequence<N>{}));
+
+inline std::uint32_t payload(std::uint32_t value) { return value; }
+inline std::uint32_t payload(const std::string &value) {
+  return static_cast<std::uint32_t>(value.size());
+}
+
+/**
+ * @brief The work done by every handler: depends on both the payload and
+ *        the alternative, so the compiler cannot merge the cases.
+ */
+template <std::size_t I, template <std::size_t> class Payload>
+inline std::uint32_t handle(const Payload<I> &alt) {
+  return payload(alt.value) * static_cast<std::uint32_t>(2 * I + 1);
+}
+
+/**
+ * @brief Number of elements cycled through by every benchmark. A power of
+ *        two, large enough to defeat branch history, small enough for L2.
+ */
+inline constexpr std::size_t sample_size = 4096;
+
+template <typename Variant, std::size_t I>
+Variant make_alternative_impl(std::size_t index, std::uint32_t seed) {
+  if constexpr (I + 1 < std::variant_size_v<Variant>) {
+    if (index != I) {
+      return make_alternative_impl<Variant, I + 1>(index, seed);
+    }
+  }
+  using Alternative = std::variant_alternative_t<I, Variant>;
+  if constexpr (std::is_same_v<decltype(Alternative::value), std::string>) {
+    // Long enough to live on the heap, not in the small-string buffer
+    return Variant{std::in_place_index<I>,
+                   Alternative{std::string(32 + seed % 16, 'x')}};
+  } else {
+    return Variant{std::in_place_index<I>, Alternative{seed}};
+  }
+}
+
+/**
+ * @brief Uniformly mixed sample of variants, the worst case for the branch
+ *        predictor.
+ */
+template <typename Variant> std::vector<Variant> make_variants() {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<std::size_t> pick(
+      0, std::variant_size_v<Variant> - 1);
+
+  std::vector<Variant> sample;
+  sample.reserve(sample_size);
+  for (std::size_t i = 0; i < sample_size; ++i) {
+    sample.push_back(make_alternative_impl<Variant, 0>(
+        pick(rng), static_cast<std::uint32_t>(rng())));
+  }
+  return sample;
+}
+
+/**
+ * @brief Sample of engaged/empty flags with the given share of engaged
+ *        elements.
+ */
+inline std::vector<bool> make_flags(double engaged_share) {
+  std::mt19937 rng(42);
+  std::bernoulli_distribution engaged(engaged_share);
+
+  std::vector<bool> flags;
+  flags.reserve(sample_size);
+  for (std::size_t i = 0; i < sample_size; ++i) {
+    flags.push_back(engaged(rng));
+  }
+  return flags;
+}
+
+} // namespace bench
@@ -0,0 +1,55 @@
+#!/usr/bin/env bash
+# Measures the compile time and peak memory of one translation unit that
+# inspects variants of a growing number of alternatives, with the default
+# per-alternative validation and with ADT_INSPECT_FAST_COMPILE, in C++17
+# (enable_if_t overloads) and C++20 (concept-constrained overloads).
+#
+# Usage: CXX=clang++ STANDARDS="c++17 c++20" \
+#        bench/compile/compile_time.sh [alternatives...]
+
+set -euo pipefail
+
+root="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+cxx="${CXX:-clang++}"
+read -r -a standards <<<"${STANDARDS:-c++17 c++20}"
+sizes=("$@")
+if [ ${#sizes[@]} -eq 0 ]; then
+  sizes=(8 16 32 48 64)
+fi
+
+# Prints "<seconds> <peak KiB>" for one compilation
+measure() {
+  if [ -x /usr/bin/time ]; then
+    /usr/bin/time -f "%e %M" "$@" 2>&1 >/dev/null | tail -n 1
+  elif command -v python3 >/dev/null; then
+    python3 - "$@" <<'PY'
+import resource, subprocess, sys, time
+start = time.monotonic()
+subprocess.run(sys.argv[1:], check=True, stdout=subprocess.DEVNULL)
+elapsed = time.monotonic() - start
+peak = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+print(f"{elapsed:.2f} {peak}")
+PY
+  else
+    local start end
+    start=$(date +%s%N)
+    "$@" >/dev/null
+    end=$(date +%s%N)
+    echo "$(( (end - start) / 10000000 ))e-2 n/a"
+  fi
+}
+
+printf "%-8s %-14s %-12s %10s %12s\n" \
+  "std" "alternatives" "validation" "seconds" "peak KiB"
+for std in "${standards[@]}"; do
+  for n in "${sizes[@]}"; do
+    for fast in 0 1; do
+      read -r seconds peak < <(measure "$cxx" -std="$std" -O0 -I"$root/inc" \
+        -DADT_BENCH_ALTERNATIVES="$n" -DADT_INSPECT_FAST_COMPILE="$fast" \
+        -c "$root/bench/compile/variant_tu.cpp" -o /dev/null)
+      mode=$([ "$fast" = 1 ] && echo "fast" || echo "per-alt")
+      printf "%-8s %-14s %-12s %10s %12s\n" \
+        "$std" "$n" "$mode" "$seconds" "$peak"
+    done
+  done
+done
@@ -0,0 +1,67 @@
+/**
+ * @file variant_tu.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief A translation unit for the compile-time benchmark: it inspects
+ *        ADT_BENCH_VARIANTS distinct variants of ADT_BENCH_ALTERNATIVES
+ *        alternatives each, once with a generic handler and once with one
+ *        handler per alternative.
+ * @version 0.1
+ * @date 2026-01-09
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <utility>
+#include <variant>
+
+#include "inspect.hh"
+
+#ifndef ADT_BENCH_ALTERNATIVES
+#define ADT_BENCH_ALTERNATIVES 32
+#endif
+
+#ifndef ADT_BENCH_VARIANTS
+#define ADT_BENCH_VARIANTS 16
+#endif
+
+namespace {
+
+template <std::size_t Tag, std::size_t I> struct Alternative {
+  int value;
+};
+
+template <std::size_t Tag, std::size_t... Is>
+std::variant<Alternative<Tag, Is>...> make_variant(std::index_sequence<Is...>);
+
+template <std::size_t Tag>
+using Variant = decltype(make_variant<Tag>(
+    std::make_index_sequence<ADT_BENCH_ALTERNATIVES>{}));
+
+template <std::size_t Tag, std::size_t I> struct Handler {
+  int operator()(const Alternative<Tag, I> &alt) const noexcept {
+    return alt.value + static_cast<int>(I);
+  }
+};
+
+template <std::size_t Tag, std::size_t... Is>
+int inspect_each_handler(const Variant<Tag> &variant,
+                         std::index_sequence<Is...>) {
+  return adt::Inspect(variant, Handler<Tag, Is>{}...);
+}
+
+template <std::size_t Tag> int inspect(const Variant<Tag> &variant) {
+  return adt::Inspect(variant,
+                      [](const auto &alt) { return alt.value; }) +
+         inspect_each_handler<Tag>(
+             variant, std::make_index_sequence<ADT_BENCH_ALTERNATIVES>{});
+}
+
+template <std::size_t... Tags> int inspect_all(std::index_sequence<Tags...>) {
+  return (inspect<Tags>(Variant<Tags>{}) + ...);
+}
+
+} // namespace
+
+int main() {
+  return inspect_all(std::make_index_sequence<ADT_BENCH_VARIANTS>{});
+}
@@ -0,0 +1,158 @@
+/**
+ * @file error_chain_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares an error passed up three layers that each prepend their
+ *        context to a std::string with the same error carried as an
+ *        adt::ErrorChain, formatted only when the top layer logs it, and
+ *        with the plain error code passed up without any context.
+ * @version 0.1
+ * @date 2026-01-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include <ostream>
+#include <streambuf>
+
+#include "error_chain.hh"
+#include "inspect.hh"
+#include "try.hh"
+
+namespace {
+
+enum class DiskError : std::uint8_t { TIMEOUT, CORRUPTED };
+
+std::ostream &operator<<(std::ostream &out, DiskError error) {
+  return out << "disk error " << +static_cast<std::uint8_t>(error);
+}
+
+// The log sink: formats everything, keeps nothing
+class DiscardBuffer : public std::streambuf {
+protected:
+  int_type overflow(int_type c) override { return c; }
+  std::streamsize xsputn(const char *, std::streamsize n) override {
+    return n;
+  }
+};
+
+std::int32_t block_of(std::int32_t input) { return input * 7 + 3; }
+
+// --- Baseline: every layer builds a longer message ---
+using Message = std::string;
+
+adt::Result<std::int32_t, Message> read_string(std::int32_t input) {
+  if (input < 0) {
+    return adt::Error<Message>("timeout while waiting for the disk");
+  }
+  return adt::Ok(block_of(input));
+}
+
+adt::Result<std::int32_t, Message> header_string(std::int32_t input) {
+  return read_string(input)
+      .map([](std::int32_t block) { return block + 16; })
+      .transform_error([](Message &&error) {
+        return "reading the block header: " + error;
+      });
+}
+
+adt::Result<std::int32_t, Message> volume_string(std::int32_t input) {
+  return header_string(input).transform_error(
+      [](Message &&error) { return "loading the volume table: " + error; });
+}
+
+adt::Result<std::int32_t, Message> mount_string(std::int32_t input) {
+  return volume_string(input).transform_error(
+      [](Message &&error) { return "mounting the data partition: " + error; });
+}
+
+// --- ErrorChain: every layer stores a pointer ---
+using Chain = adt::ErrorChain<DiskError>;
+
+adt::Result<std::int32_t, DiskError> read_chain(std::int32_t input) {
+  if (input < 0) {
+    return adt::Error(DiskError::TIMEOUT);
+  }
+  return adt::Ok(block_of(input));
+}
+
+adt::Result<std::int32_t, Chain> header_chain(std::int32_t input) {
+  ADT_TRY_ASSIGN(const std::int32_t block,
+                 adt::with_context(read_chain(input),
+                                   ADT_CONTEXT("reading the block header")));
+  return adt::Ok(block + 16);
+}
+
+adt::Result<std::int32_t, Chain> volume_chain(std::int32_t input) {
+  return adt::with_context(header_chain(input),
+                           ADT_CONTEXT("loading the volume table"));
+}
+
+adt::Result<std::int32_t, Chain> mount_chain(std::int32_t input) {
+  return adt::with_context(volume_chain(input),
+                           ADT_CONTEXT("mounting the data partition"));
+}
+
+// --- Reference: the plain error, with no context at all ---
+adt::Result<std::int32_t, DiskError> header_plain(std::int32_t input) {
+  ADT_TRY_ASSIGN(const std::int32_t block, read_chain(input));
+  return adt::Ok(block + 16);
+}
+
+adt::Result<std::int32_t, DiskError> volume_plain(std::int32_t input) {
+  return header_plain(input);
+}
+
+adt::Result<std::int32_t, DiskError> mount_plain(std::int32_t input) {
+  return volume_plain(input);
+}
+
+// Arg(0) is the percentage of inputs that fail
+std::vector<std::int32_t> make_inputs(benchmark::State &state) {
+  const auto flags = bench::make_flags(
+      1.0 - static_cast<double>(state.range(0)) / 100.0);
+  std::vector<std::int32_t> inputs;
+  inputs.reserve(flags.size());
+  for (std::size_t i = 0; i < flags.size(); ++i) {
+    const auto value = static_cast<std::int32_t>(i);
+    inputs.push_back(flags[i] ? value : -value - 1);
+  }
+  return inputs;
+}
+
+template <typename Mount>
+void run_mounts(benchmark::State &state, Mount mount) {
+  const auto inputs = make_inputs(state);
+  DiscardBuffer discard;
+  std::ostream log(&discard);
+  bench::run_measured(state, [&] {
+    std::int64_t sum = 0;
+    for (std::int32_t input : inputs) {
+      adt::Inspect(
+          mount(input), [&](std::int32_t block) { sum += block; },
+          [&](const auto &error) { log << error << '\n'; });
+    }
+    benchmark::DoNotOptimize(sum);
+  });
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(inputs.size()));
+}
+
+void BM_ContextNone(benchmark::State &state) {
+  run_mounts(state, mount_plain);
+}
+
+void BM_ContextStringConcat(benchmark::State &state) {
+  run_mounts(state, mount_string);
+}
+
+void BM_ContextErrorChain(benchmark::State &state) {
+  run_mounts(state, mount_chain);
+}
+
+BENCHMARK(BM_ContextNone)->Arg(0)->Arg(1)->Arg(10);
+BENCHMARK(BM_ContextStringConcat)->Arg(0)->Arg(1)->Arg(10);
+BENCHMARK(BM_ContextErrorChain)->Arg(0)->Arg(1)->Arg(10);
+
+} // namespace
@@ -0,0 +1,475 @@
+/**
+ * @file inspect_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares adt::Inspect on std::variant, std::optional and adt::Result
+ *        with the hand-written code it replaces: std::visit, a switch on
+ *        index(), an if-chain and a plain has_value() test, and the
+ *        adt::hot hint against the switch on a skewed sample.
+ * @version 0.1
+ * @date 2026-01-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include <optional>
+
+#include "inspect.hh"
+#include "result.hh"
+
+namespace {
+
+using bench::Heap;
+using bench::Trivial;
+
+// --- Hand-written baselines ---
+template <typename Variant>
+std::uint32_t switch_baseline(const Variant &variant) {
+  constexpr std::size_t N = std::variant_size_v<Variant>;
+  static_assert(N <= 32);
+
+  switch (variant.index()) {
+#define BENCH_SWITCH_CASE(I)                                                   \
+  case I:                                                                      \
+    if constexpr (I < N) {                                                     \
+      return bench::handle(*std::get_if<I>(&variant));                         \
+    }                                                                          \
+    [[fallthrough]];
+
+    BENCH_SWITCH_CASE(0)
+    BENCH_SWITCH_CASE(1)
+    BENCH_SWITCH_CASE(2)
+    BENCH_SWITCH_CASE(3)
+    BENCH_SWITCH_CASE(4)
+    BENCH_SWITCH_CASE(5)
+    BENCH_SWITCH_CASE(6)
+    BENCH_SWITCH_CASE(7)
+    BENCH_SWITCH_CASE(8)
+    BENCH_SWITCH_CASE(9)
+    BENCH_SWITCH_CASE(10)
+    BENCH_SWITCH_CASE(11)
+    BENCH_SWITCH_CASE(12)
+    BENCH_SWITCH_CASE(13)
+    BENCH_SWITCH_CASE(14)
+    BENCH_SWITCH_CASE(15)
+    BENCH_SWITCH_CASE(16)
+    BENCH_SWITCH_CASE(17)
+    BENCH_SWITCH_CASE(18)
+    BENCH_SWITCH_CASE(19)
+    BENCH_SWITCH_CASE(20)
+    BENCH_SWITCH_CASE(21)
+    BENCH_SWITCH_CASE(22)
+    BENCH_SWITCH_CASE(23)
+    BENCH_SWITCH_CASE(24)
+    BENCH_SWITCH_CASE(25)
+    BENCH_SWITCH_CASE(26)
+    BENCH_SWITCH_CASE(27)
+    BENCH_SWITCH_CASE(28)
+    BENCH_SWITCH_CASE(29)
+    BENCH_SWITCH_CASE(30)
+    BENCH_SWITCH_CASE(31)
+
+#undef BENCH_SWITCH_CASE
+
+  default:
+    return 0;
+  }
+}
+
+template <typename Variant, std::size_t... Is>
+std::uint32_t if_chain_baseline(const Variant &variant,
+                                std::index_sequence<Is...>) {
+  std::uint32_t result = 0;
+  ((variant.index() == Is
+        ? (result = bench::handle(*std::get_if<Is>(&variant)), true)
+        : false) ||
+   ...);
+  return result;
+}
+
+// --- std::variant ---
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_VariantInspect(benchmark::State &state) {
+  const auto sample = bench::make_variants<bench::VariantOf<Payload, N>>();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    const auto &variant = sample[i++ % bench::sample_size];
+    benchmark::DoNotOptimize(adt::Inspect(
+        variant, [](const auto &alt) { return bench::handle(alt); }));
+  });
+}
+
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_VariantStdVisit(benchmark::State &state) {
+  const auto sample = bench::make_variants<bench::VariantOf<Payload, N>>();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    const auto &variant = sample[i++ % bench::sample_size];
+    benchmark::DoNotOptimize(std::visit(
+        [](const auto &alt) { return bench::handle(alt); }, variant));
+  });
+}
+
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_VariantSwitch(benchmark::State &state) {
+  const auto sample = bench::make_variants<bench::VariantOf<Payload, N>>();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(
+        switch_baseline(sample[i++ % bench::sample_size]));
+  });
+}
+
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_VariantIfChain(benchmark::State &state) {
+  const auto sample = bench::make_variants<bench::VariantOf<Payload, N>>();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(if_chain_baseline(
+        sample[i++ % bench::sample_size], std::make_index_sequence<N>{}));
+  });
+}
+
+#define BENCH_VARIANT(Name)                                                    \
+  BENCHMARK_TEMPLATE(Name, Trivial, 2);                                        \
+  BENCHMARK_TEMPLATE(Name, Trivial, 4);                                        \
+  BENCHMARK_TEMPLATE(Name, Trivial, 8);                                        \
+  BENCHMARK_TEMPLATE(Name, Trivial, 32);                                       \
+  BENCHMARK_TEMPLATE(Name, Heap, 2);                                           \
+  BENCHMARK_TEMPLATE(Name, Heap, 4);                                           \
+  BENCHMARK_TEMPLATE(Name, Heap, 8);                                           \
+  BENCHMARK_TEMPLATE(Name, Heap, 32)
+
+BENCH_VARIANT(BM_VariantInspect);
+BENCH_VARIANT(BM_VariantStdVisit);
+BENCH_VARIANT(BM_VariantSwitch);
+BENCH_VARIANT(BM_VariantIfChain);
+
+// --- Two variants at once: one flattened dispatch against nested Inspects ---
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_PairInspect(benchmark::State &state) {
+  const auto sample = bench::make_variants<bench::VariantOf<Payload, N>>();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    const auto &first = sample[i % bench::sample_size];
+    const auto &second = sample[(i * 7 + 1) % bench::sample_size];
+    ++i;
+    benchmark::DoNotOptimize(
+        adt::Inspect(first, second, [](const auto &a, const auto &b) {
+          return bench::handle(a) ^ bench::handle(b);
+        }));
+  });
+}
+
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_PairNestedInspect(benchmark::State &state) {
+  const auto sample = bench::make_variants<bench::VariantOf<Payload, N>>();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    const auto &first = sample[i % bench::sample_size];
+    const auto &second = sample[(i * 7 + 1) % bench::sample_size];
+    ++i;
+    benchmark::DoNotOptimize(adt::Inspect(first, [&](const auto &a) {
+      return adt::Inspect(second, [&](const auto &b) {
+        return bench::handle(a) ^ bench::handle(b);
+      });
+    }));
+  });
+}
+
+// 5 x 5 = 25 combinations use the flattened switch, 8 x 8 = 64 do not
+BENCHMARK_TEMPLATE(BM_PairInspect, Trivial, 5);
+BENCHMARK_TEMPLATE(BM_PairInspect, Trivial, 8);
+BENCHMARK_TEMPLATE(BM_PairNestedInspect, Trivial, 5);
+BENCHMARK_TEMPLATE(BM_PairNestedInspect, Trivial, 8);
+
+// --- std::optional, Arg(0) is the share of engaged elements in percent ---
+template <typename T> T make_value(std::uint32_t seed) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return std::string(32 + seed % 16, 'x');
+  } else {
+    return seed;
+  }
+}
+
+template <typename T>
+std::vector<std::optional<T>> make_optionals(benchmark::State &state) {
+  const auto flags = bench::make_flags(state.range(0) / 100.0);
+  std::vector<std::optional<T>> sample;
+  sample.reserve(bench::sample_size);
+  for (std::size_t i = 0; i < bench::sample_size; ++i) {
+    sample.push_back(flags[i] ? std::optional<T>{make_value<T>(i)}
+                              : std::nullopt);
+  }
+  return sample;
+}
+
+template <typename T> void BM_OptionalInspect(benchmark::State &state) {
+  const auto sample = make_optionals<T>(state);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::Inspect(
+        sample[i++ % bench::sample_size],
+        [](const T &value) { return bench::payload(value); },
+        []() { return std::uint32_t{0}; }));
+  });
+}
+
+template <typename T> void BM_OptionalHasValue(benchmark::State &state) {
+  const auto sample = make_optionals<T>(state);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    const auto &opt = sample[i++ % bench::sample_size];
+    std::uint32_t result = 0;
+    if (opt.has_value()) {
+      result = bench::payload(*opt);
+    }
+    benchmark::DoNotOptimize(result);
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_OptionalInspect, std::uint32_t)->Arg(50)->Arg(99);
+BENCHMARK_TEMPLATE(BM_OptionalHasValue, std::uint32_t)->Arg(50)->Arg(99);
+BENCHMARK_TEMPLATE(BM_OptionalInspect, std::string)->Arg(50)->Arg(99);
+BENCHMARK_TEMPLATE(BM_OptionalHasValue, std::string)->Arg(50)->Arg(99);
+
+// --- adt::Result, Arg(0) is the share of successes in percent ---
+enum class ErrorCode : std::uint32_t { TIMEOUT = 1, CLOSED = 2 };
+
+template <typename T>
+std::vector<adt::Result<T, ErrorCode>> make_results(benchmark::State &state) {
+  const auto flags = bench::make_flags(state.range(0) / 100.0);
+  std::vector<adt::Result<T, ErrorCode>> sample;
+  sample.reserve(bench::sample_size);
+  for (std::size_t i = 0; i < bench::sample_size; ++i) {
+    if (flags[i]) {
+      sample.push_back(adt::Ok(make_value<T>(i)));
+    } else {
+      sample.push_back(adt::Error(ErrorCode::TIMEOUT));
+    }
+  }
+  return sample;
+}
+
+template <typename T> void BM_ResultInspect(benchmark::State &state) {
+  const auto sample = make_results<T>(state);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::Inspect(
+        sample[i++ % bench::sample_size],
+        [](const T &value) { return bench::payload(value); },
+        [](ErrorCode err) { return static_cast<std::uint32_t>(err); }));
+  });
+}
+
+template <typename T> void BM_ResultHasValue(benchmark::State &state) {
+  const auto sample = make_results<T>(state);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    const auto &result = sample[i++ % bench::sample_size];
+    std::uint32_t out = 0;
+    if (result.has_value()) {
+      out = bench::payload(*result);
+    } else {
+      out = static_cast<std::uint32_t>(result.unsafe_error());
+    }
+    benchmark::DoNotOptimize(out);
+  });
+}
+
+// The error handler formats a message, as error paths usually do, so its
+// code competes with the hot path unless it is moved to the cold section
+template <typename T> void BM_ResultRareError(benchmark::State &state) {
+  const auto sample = make_results<T>(state);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::Inspect(
+        sample[i++ % bench::sample_size],
+        [](const T &value) { return bench::payload(value); },
+        [](ErrorCode err) {
+          return static_cast<std::uint32_t>(
+              ("error " + std::to_string(static_cast<int>(err))).size());
+        }));
+  });
+}
+
+template <typename T> void BM_ResultRareErrorLikely(benchmark::State &state) {
+  const auto sample = make_results<T>(state);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::InspectLikely(
+        sample[i++ % bench::sample_size],
+        [](const T &value) { return bench::payload(value); },
+        [](ErrorCode err) {
+          return static_cast<std::uint32_t>(
+              ("error " + std::to_string(static_cast<int>(err))).size());
+        }));
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_ResultInspect, std::uint32_t)->Arg(50)->Arg(99);
+BENCHMARK_TEMPLATE(BM_ResultHasValue, std::uint32_t)->Arg(50)->Arg(99);
+BENCHMARK_TEMPLATE(BM_ResultInspect, std::string)->Arg(50)->Arg(99);
+BENCHMARK_TEMPLATE(BM_ResultHasValue, std::string)->Arg(50)->Arg(99);
+BENCHMARK_TEMPLATE(BM_ResultRareError, std::uint32_t)->Arg(99)->Arg(100);
+BENCHMARK_TEMPLATE(BM_ResultRareErrorLikely, std::uint32_t)
+    ->Arg(99)
+    ->Arg(100);
+
+// --- Value patterns against a type switch followed by an if/else ladder ---
+using Reading = std::variant<std::uint32_t, std::string>;
+
+std::vector<Reading> make_readings() {
+  std::vector<Reading> sample;
+  sample.reserve(bench::sample_size);
+  for (std::uint32_t i = 0; i < bench::sample_size; ++i) {
+    const std::uint32_t seed = (i * 2654435761u) >> 20;
+    if (seed % 4 == 0) {
+      sample.emplace_back(std::string(seed % 3 == 0 ? "n/a" : "reading"));
+    } else {
+      sample.emplace_back(seed % 700);
+    }
+  }
+  return sample;
+}
+
+void BM_ReadingLadder(benchmark::State &state) {
+  const auto sample = make_readings();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::Inspect(
+        sample[i++ % bench::sample_size],
+        [](std::uint32_t value) -> std::uint32_t {
+          if (value == 0) {
+            return 1;
+          }
+          if (value >= 200 && value <= 299) {
+            return 2;
+          }
+          if (value >= 400 && value <= 599) {
+            return 3;
+          }
+          return value;
+        },
+        [](const std::string &text) -> std::uint32_t {
+          if (text == "n/a") {
+            return 4;
+          }
+          return static_cast<std::uint32_t>(text.size());
+        }));
+  });
+}
+
+void BM_ReadingPatterns(benchmark::State &state) {
+  const auto sample = make_readings();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::Inspect(
+        sample[i++ % bench::sample_size],
+        adt::eq(0u, [](std::uint32_t) { return std::uint32_t{1}; }),
+        adt::range(200u, 299u, [](std::uint32_t) { return std::uint32_t{2}; }),
+        adt::range(400u, 599u, [](std::uint32_t) { return std::uint32_t{3}; }),
+        adt::eq("n/a", [](const std::string &) { return std::uint32_t{4}; }),
+        [](std::uint32_t value) { return value; },
+        [](const std::string &text) {
+          return static_cast<std::uint32_t>(text.size());
+        }));
+  });
+}
+
+BENCHMARK(BM_ReadingLadder);
+BENCHMARK(BM_ReadingPatterns);
+
+// --- One alternative covering 95% of the sample: switch against adt::hot ---
+template <typename Variant, std::size_t Hot>
+std::vector<Variant> make_skewed() {
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<std::size_t> pick(
+      0, std::variant_size_v<Variant> - 1);
+  const auto dominant = bench::make_flags(0.95);
+
+  std::vector<Variant> sample;
+  sample.reserve(bench::sample_size);
+  for (std::size_t i = 0; i < bench::sample_size; ++i) {
+    sample.push_back(bench::make_alternative_impl<Variant, 0>(
+        dominant[i] ? Hot : pick(rng), static_cast<std::uint32_t>(rng())));
+  }
+  return sample;
+}
+
+template <std::size_t N> void BM_SkewedSwitch(benchmark::State &state) {
+  using Variant = bench::VariantOf<bench::Trivial, N>;
+  const auto sample = make_skewed<Variant, N / 2>();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(
+        adt::Inspect(sample[i++ % bench::sample_size],
+                     [](const auto &alt) { return bench::handle(alt); }));
+  });
+}
+
+template <std::size_t N> void BM_SkewedHot(benchmark::State &state) {
+  using Variant = bench::VariantOf<bench::Trivial, N>;
+  const auto sample = make_skewed<Variant, N / 2>();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(
+        adt::Inspect<adt::hot<bench::Trivial<N / 2>>>(
+            sample[i++ % bench::sample_size],
+            [](const auto &alt) { return bench::handle(alt); }));
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_SkewedSwitch, 8);
+BENCHMARK_TEMPLATE(BM_SkewedHot, 8);
+BENCHMARK_TEMPLATE(BM_SkewedSwitch, 32);
+BENCHMARK_TEMPLATE(BM_SkewedHot, 32);
+
+// --- Inspect<R> with an explicit return type ---
+// Every handler builds one heap-allocated string: allocs/op must stay at 1,
+// the result of the handler is constructed directly in the return slot.
+std::string make_label(std::uint32_t seed) {
+  return std::string(32 + seed % 16, 'x');
+}
+
+void BM_ExplicitReturnVariant(benchmark::State &state) {
+  const auto sample =
+      bench::make_variants<bench::VariantOf<bench::Trivial, 4>>();
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::Inspect<std::string>(
+        sample[i++ % bench::sample_size],
+        [](const auto &alt) { return make_label(bench::handle(alt)); }));
+  });
+}
+
+void BM_ExplicitReturnOptional(benchmark::State &state) {
+  const auto sample = make_optionals<std::uint32_t>(state);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::Inspect<std::string>(
+        sample[i++ % bench::sample_size],
+        [](std::uint32_t value) { return make_label(value); },
+        []() { return make_label(0); }));
+  });
+}
+
+void BM_ExplicitReturnResult(benchmark::State &state) {
+  const auto sample = make_results<std::uint32_t>(state);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::Inspect<std::string>(
+        sample[i++ % bench::sample_size],
+        [](std::uint32_t value) { return make_label(value); },
+        [](ErrorCode err) {
+          return make_label(static_cast<std::uint32_t>(err));
+        }));
+  });
+}
+
+BENCHMARK(BM_ExplicitReturnVariant);
+BENCHMARK(BM_ExplicitReturnOptional)->Arg(50);
+BENCHMARK(BM_ExplicitReturnResult)->Arg(50);
+
+} // namespace
@@ -0,0 +1,112 @@
+/**
+ * @file inspect_each_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares a per-element Inspect loop with InspectEach and its
+ *        type-partitioned form over a mixed range of variants, and the same
+ *        data stored in an adt::VariantVector.
+ * @version 0.1
+ * @date 2026-01-06
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include "variant_vector.hh"
+
+namespace {
+
+using bench::Heap;
+using bench::Trivial;
+
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_RangeInspectLoop(benchmark::State &state) {
+  const auto sample = bench::make_variants<bench::VariantOf<Payload, N>>();
+  bench::run_measured(state, [&] {
+    std::uint32_t sum = 0;
+    for (const auto &variant : sample) {
+      sum += adt::Inspect(variant,
+                          [](const auto &alt) { return bench::handle(alt); });
+    }
+    benchmark::DoNotOptimize(sum);
+  });
+  state.SetItemsProcessed(state.iterations() * bench::sample_size);
+}
+
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_RangeInspectEach(benchmark::State &state) {
+  const auto sample = bench::make_variants<bench::VariantOf<Payload, N>>();
+  bench::run_measured(state, [&] {
+    std::uint32_t sum = 0;
+    adt::InspectEach(sample,
+                     [&](const auto &alt) { sum += bench::handle(alt); });
+    benchmark::DoNotOptimize(sum);
+  });
+  state.SetItemsProcessed(state.iterations() * bench::sample_size);
+}
+
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_RangeInspectEachPartitioned(benchmark::State &state) {
+  const auto sample = bench::make_variants<bench::VariantOf<Payload, N>>();
+  bench::run_measured(state, [&] {
+    std::uint32_t sum = 0;
+    adt::InspectEach(adt::partitioned, sample,
+                     [&](const auto &alt) { sum += bench::handle(alt); });
+    benchmark::DoNotOptimize(sum);
+  });
+  state.SetItemsProcessed(state.iterations() * bench::sample_size);
+}
+
+#define BENCH_RANGE(Name)                                                      \
+  BENCHMARK_TEMPLATE(Name, Trivial, 4);                                        \
+  BENCHMARK_TEMPLATE(Name, Trivial, 8);                                        \
+  BENCHMARK_TEMPLATE(Name, Heap, 4);                                           \
+  BENCHMARK_TEMPLATE(Name, Heap, 8)
+
+BENCH_RANGE(BM_RangeInspectLoop);
+BENCH_RANGE(BM_RangeInspectEach);
+BENCH_RANGE(BM_RangeInspectEachPartitioned);
+
+template <typename Variant> struct vector_of;
+template <typename... Ts> struct vector_of<std::variant<Ts...>> {
+  using type = adt::VariantVector<Ts...>;
+};
+
+template <template <std::size_t> class Payload, std::size_t N>
+typename vector_of<bench::VariantOf<Payload, N>>::type make_lanes() {
+  typename vector_of<bench::VariantOf<Payload, N>>::type lanes;
+  for (const auto &variant :
+       bench::make_variants<bench::VariantOf<Payload, N>>()) {
+    lanes.push_back(variant);
+  }
+  return lanes;
+}
+
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_VariantVectorInOrder(benchmark::State &state) {
+  const auto lanes = make_lanes<Payload, N>();
+  bench::run_measured(state, [&] {
+    std::uint32_t sum = 0;
+    adt::InspectEach(lanes,
+                     [&](const auto &alt) { sum += bench::handle(alt); });
+    benchmark::DoNotOptimize(sum);
+  });
+  state.SetItemsProcessed(state.iterations() * bench::sample_size);
+}
+
+template <template <std::size_t> class Payload, std::size_t N>
+void BM_VariantVectorPartitioned(benchmark::State &state) {
+  const auto lanes = make_lanes<Payload, N>();
+  bench::run_measured(state, [&] {
+    std::uint32_t sum = 0;
+    adt::InspectEach(adt::partitioned, lanes,
+                     [&](const auto &alt) { sum += bench::handle(alt); });
+    benchmark::DoNotOptimize(sum);
+  });
+  state.SetItemsProcessed(state.iterations() * bench::sample_size);
+}
+
+BENCH_RANGE(BM_VariantVectorInOrder);
+BENCH_RANGE(BM_VariantVectorPartitioned);
+
+} // namespace
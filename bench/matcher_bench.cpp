@@ -0,0 +1,116 @@
+/**
+ * @file matcher_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares a handler set chosen at run time stored as one
+ *        std::function per alternative with the same set stored as an
+ *        adt::Matcher, both to build and to apply, with a direct Inspect as
+ *        the reference.
+ * @version 0.1
+ * @date 2026-01-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include <array>
+#include <functional>
+
+#include "matcher.hh"
+
+namespace {
+
+using Variant = bench::VariantOf<bench::Trivial, 4>;
+
+// What a plugin's handlers capture: three words, past std::function's buffer
+struct Scales {
+  std::uint64_t add;
+  std::uint64_t mul;
+  std::uint64_t mask;
+};
+
+template <std::size_t I>
+std::uint32_t scaled(const Scales &scales, const bench::Trivial<I> &alt) {
+  return static_cast<std::uint32_t>(
+      ((bench::handle<I>(alt) + scales.add) * scales.mul) & scales.mask);
+}
+
+using FunctionTable =
+    std::array<std::function<std::uint32_t(const Variant &)>, 4>;
+
+template <std::size_t... Is>
+FunctionTable make_functions(const Scales &scales, std::index_sequence<Is...>) {
+  return {[scales](const Variant &v) {
+    return scaled(scales, *std::get_if<Is>(&v));
+  }...};
+}
+
+using Handlers = adt::Matcher<Variant, std::uint32_t>;
+
+// One object holds every handler, so the captures are stored once
+Handlers make_matcher(const Scales &scales) {
+  return Handlers([scales](const auto &alt) { return scaled(scales, alt); });
+}
+
+Scales pick_scales(benchmark::State &state) {
+  // Only known at run time, as if read from a plugin table
+  const auto seed = static_cast<std::uint64_t>(state.range(0));
+  return {seed, seed * 3 + 1, ~0u};
+}
+
+void BM_ApplyStdFunctions(benchmark::State &state) {
+  const auto sample = bench::make_variants<Variant>();
+  const FunctionTable handlers =
+      make_functions(pick_scales(state), std::make_index_sequence<4>{});
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    const Variant &v = sample[i++ % bench::sample_size];
+    benchmark::DoNotOptimize(handlers[v.index()](v));
+  });
+}
+
+void BM_ApplyMatcher(benchmark::State &state) {
+  const auto sample = bench::make_variants<Variant>();
+  const Handlers handlers = make_matcher(pick_scales(state));
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(handlers(sample[i++ % bench::sample_size]));
+  });
+}
+
+// Reference: the handlers are known at compile time
+void BM_ApplyInspect(benchmark::State &state) {
+  const auto sample = bench::make_variants<Variant>();
+  const Scales scales = pick_scales(state);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::Inspect<std::uint32_t>(
+        sample[i++ % bench::sample_size],
+        [&](const auto &alt) { return scaled(scales, alt); }));
+  });
+}
+
+void BM_BuildStdFunctions(benchmark::State &state) {
+  const Scales scales = pick_scales(state);
+  bench::run_measured(state, [&] {
+    FunctionTable handlers =
+        make_functions(scales, std::make_index_sequence<4>{});
+    benchmark::DoNotOptimize(handlers);
+  });
+}
+
+void BM_BuildMatcher(benchmark::State &state) {
+  const Scales scales = pick_scales(state);
+  bench::run_measured(state, [&] {
+    Handlers handlers = make_matcher(scales);
+    benchmark::DoNotOptimize(handlers);
+  });
+}
+
+BENCHMARK(BM_ApplyStdFunctions)->Arg(1);
+BENCHMARK(BM_ApplyMatcher)->Arg(1);
+BENCHMARK(BM_ApplyInspect)->Arg(1);
+BENCHMARK(BM_BuildStdFunctions)->Arg(1);
+BENCHMARK(BM_BuildMatcher)->Arg(1);
+
+} // namespace
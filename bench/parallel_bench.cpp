@@ -0,0 +1,108 @@
+/**
+ * @file parallel_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares the sequential and parallel InspectReduce over large
+ *        ranges of variants and Results.
+ * @version 0.1
+ * @date 2026-01-08
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include <functional>
+
+#include "parallel.hh"
+#include "result.hh"
+
+namespace {
+
+using bench::Trivial;
+
+using Sample = bench::VariantOf<Trivial, 8>;
+
+// Arg(0) is the number of elements, built by repeating the shared sample
+std::vector<Sample> make_large_sample(benchmark::State &state) {
+  const auto sample = bench::make_variants<Sample>();
+  std::vector<Sample> large;
+  large.reserve(static_cast<std::size_t>(state.range(0)));
+  while (large.size() < static_cast<std::size_t>(state.range(0))) {
+    large.push_back(sample[large.size() % sample.size()]);
+  }
+  return large;
+}
+
+void BM_ReduceVariantsSequential(benchmark::State &state) {
+  const auto sample = make_large_sample(state);
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::InspectReduce(
+        sample, std::uint64_t{0}, std::plus<>{},
+        [](const auto &alt) -> std::uint64_t { return bench::handle(alt); }));
+  });
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ReduceVariantsParallel(benchmark::State &state) {
+  const auto sample = make_large_sample(state);
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::InspectReduce(
+        adt::parallel, sample, std::uint64_t{0}, std::plus<>{},
+        [](const auto &alt) -> std::uint64_t { return bench::handle(alt); }));
+  });
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+enum class ParseError : std::uint8_t { MALFORMED, OUT_OF_RANGE };
+
+using Parsed = adt::Result<std::uint32_t, ParseError>;
+
+std::vector<Parsed> make_results(benchmark::State &state) {
+  const auto flags = bench::make_flags(0.5);
+  std::vector<Parsed> results;
+  results.reserve(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t i = 0; i < static_cast<std::size_t>(state.range(0)); ++i) {
+    if (flags[i % flags.size()]) {
+      results.emplace_back(adt::Ok(static_cast<std::uint32_t>(i)));
+    } else {
+      results.emplace_back(adt::Error(ParseError::MALFORMED));
+    }
+  }
+  return results;
+}
+
+void BM_ReduceResultsSequential(benchmark::State &state) {
+  const auto results = make_results(state);
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::InspectReduce(
+        results, std::uint64_t{0}, std::plus<>{},
+        [](std::uint32_t value) -> std::uint64_t { return value; },
+        [](ParseError) -> std::uint64_t { return 0; }));
+  });
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ReduceResultsParallel(benchmark::State &state) {
+  const auto results = make_results(state);
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::InspectReduce(
+        adt::parallel, results, std::uint64_t{0}, std::plus<>{},
+        [](std::uint32_t value) -> std::uint64_t { return value; },
+        [](ParseError) -> std::uint64_t { return 0; }));
+  });
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The parallel forms are timed on the wall clock, not the calling thread CPU
+BENCHMARK(BM_ReduceVariantsSequential)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_ReduceVariantsParallel)
+    ->Arg(1 << 16)
+    ->Arg(1 << 22)
+    ->UseRealTime();
+BENCHMARK(BM_ReduceResultsSequential)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_ReduceResultsParallel)
+    ->Arg(1 << 16)
+    ->Arg(1 << 22)
+    ->UseRealTime();
+
+} // namespace
@@ -0,0 +1,119 @@
+/**
+ * @file pipeline_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares three stages applied one after the other to a vector of
+ *        Results, where every failed item is forwarded through each later
+ *        stage, with the same stages run as an adt::Pipeline on batches.
+ * @version 0.1
+ * @date 2026-01-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include "pipeline.hh"
+
+namespace {
+
+enum class IngestError : std::uint8_t { MALFORMED, REJECTED };
+
+using Parsed = adt::Result<std::uint32_t, IngestError>;
+
+constexpr std::size_t items_per_run = 16 * bench::sample_size;
+
+// Work of a stage: enough that the stages are worth running in parallel
+std::uint32_t mix(std::uint32_t value) {
+  for (int round = 0; round < 64; ++round) {
+    value ^= value >> 13;
+    value *= 0x5bd1e995u;
+  }
+  return value;
+}
+
+Parsed parse(std::uint32_t raw) {
+  if (raw % 5 == 0) {
+    return adt::Error(IngestError::MALFORMED);
+  }
+  return adt::Ok(mix(raw));
+}
+
+std::uint32_t score(std::uint32_t value) { return mix(value + 1); }
+
+Parsed check(std::uint32_t value) {
+  if (value % 97 == 0) {
+    return adt::Error(IngestError::REJECTED);
+  }
+  return adt::Ok(mix(value));
+}
+
+std::vector<std::uint32_t> make_inputs() {
+  std::vector<std::uint32_t> inputs(items_per_run);
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    inputs[i] = static_cast<std::uint32_t>(i * 2654435761u) >> 8;
+  }
+  return inputs;
+}
+
+// --- Baseline: each stage maps the whole vector, errors included ---
+void BM_StagesForwardErrors(benchmark::State &state) {
+  const auto inputs = make_inputs();
+  std::vector<Parsed> items;
+  items.reserve(inputs.size());
+  std::uint64_t sum = 0;
+  std::uint64_t errors = 0;
+  bench::run_measured(state, [&] {
+    items.clear();
+    for (std::uint32_t raw : inputs) {
+      items.push_back(parse(raw));
+    }
+    for (Parsed &item : items) {
+      item = item.map(score);
+    }
+    for (Parsed &item : items) {
+      item = item.and_then(check);
+    }
+    for (const Parsed &item : items) {
+      if (item.has_value()) {
+        sum += item.value();
+      } else {
+        ++errors;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(errors);
+  });
+  state.SetItemsProcessed(state.iterations() * items_per_run);
+}
+
+void BM_Pipeline(benchmark::State &state) {
+  const auto inputs = make_inputs();
+  adt::pipeline_policy policy;
+  policy.batch = static_cast<std::size_t>(state.range(0));
+  auto ingest = adt::pipeline<std::uint32_t, IngestError>(policy)
+                    .then(parse)
+                    .then(score)
+                    .then(check);
+  std::uint64_t sum = 0;
+  std::uint64_t errors = 0;
+  bench::run_measured(state, [&] {
+    ingest.run(
+        inputs, [&](std::uint32_t value) { sum += value; },
+        [&](IngestError) { ++errors; });
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(errors);
+  });
+  state.SetItemsProcessed(state.iterations() * items_per_run);
+
+  // Busy time per item of every stage, to spot the slow one
+  for (std::size_t stage = 0; stage < ingest.stage_count(); ++stage) {
+    const adt::stage_stats stats = ingest.stats(stage);
+    state.counters["stage" + std::to_string(stage) + "-ns/item"] =
+        stats.throughput() == 0 ? 0 : 1e9 / stats.throughput();
+  }
+}
+
+BENCHMARK(BM_StagesForwardErrors)->UseRealTime();
+BENCHMARK(BM_Pipeline)->Arg(64)->Arg(256)->Arg(1024)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,204 @@
+/**
+ * @file result_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares a 5-step pipeline written with the Result combinators
+ *        against the same steps chained with hand-written early returns.
+ *        Both must report the same allocs/op: the combinators move the
+ *        string through the chain and never copy it. Also compares error
+ *        messages allocated on the heap with messages in an ErrorArena, and
+ *        eager lookups with LazyResult when most outcomes are never read.
+ * @version 0.1
+ * @date 2026-01-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include <algorithm>
+#include <cctype>
+
+#include "error_arena.hh"
+#include "inspect.hh"
+#include "lazy_result.hh"
+#include "result.hh"
+
+namespace {
+
+enum class ParseError { EMPTY, TOO_LONG, NOT_ALPHA };
+
+using Text = adt::Result<std::string, ParseError>;
+
+Text require_non_empty(std::string &&text) {
+  if (text.empty()) {
+    return adt::Error(ParseError::EMPTY);
+  }
+  return adt::Ok(std::move(text));
+}
+
+Text require_short(std::string &&text) {
+  if (text.size() > 64) {
+    return adt::Error(ParseError::TOO_LONG);
+  }
+  return adt::Ok(std::move(text));
+}
+
+Text require_alpha(std::string &&text) {
+  for (char c : text) {
+    if (!std::isalpha(static_cast<unsigned char>(c))) {
+      return adt::Error(ParseError::NOT_ALPHA);
+    }
+  }
+  return adt::Ok(std::move(text));
+}
+
+std::string capitalize(std::string &&text) {
+  text.front() = static_cast<char>(
+      std::toupper(static_cast<unsigned char>(text.front())));
+  return std::move(text);
+}
+
+std::string reverse(std::string &&text) {
+  std::reverse(text.begin(), text.end());
+  return std::move(text);
+}
+
+Text pipeline_combinators(std::string text) {
+  return require_non_empty(std::move(text))
+      .and_then(require_short)
+      .and_then(require_alpha)
+      .map(capitalize)
+      .map(reverse);
+}
+
+Text pipeline_early_return(std::string text) {
+  Text checked = require_non_empty(std::move(text));
+  if (!checked.has_value()) {
+    return checked;
+  }
+  checked = require_short(std::move(*checked));
+  if (!checked.has_value()) {
+    return checked;
+  }
+  checked = require_alpha(std::move(*checked));
+  if (!checked.has_value()) {
+    return checked;
+  }
+  std::string capitalized = capitalize(std::move(*checked));
+  return adt::Ok(reverse(std::move(capitalized)));
+}
+
+// Arg(0) selects the input: 0 passes every step, 1 fails on the third one
+const std::string &pipeline_input(benchmark::State &state) {
+  static const std::string valid(40, 'a');
+  static const std::string invalid = std::string(39, 'a') + "1";
+  return state.range(0) == 0 ? valid : invalid;
+}
+
+void BM_PipelineCombinators(benchmark::State &state) {
+  const std::string &input = pipeline_input(state);
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(pipeline_combinators(input));
+  });
+}
+
+void BM_PipelineEarlyReturn(benchmark::State &state) {
+  const std::string &input = pipeline_input(state);
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(pipeline_early_return(input));
+  });
+}
+
+BENCHMARK(BM_PipelineCombinators)->Arg(0)->Arg(1);
+BENCHMARK(BM_PipelineEarlyReturn)->Arg(0)->Arg(1);
+
+// A request whose Arg(0) lookups all fail with a message too long for SSO
+constexpr const char *lookup_failure =
+    "lookup failed: the key is not present in the configuration store";
+
+template <typename Message, typename MakeError>
+std::size_t failing_request(std::int64_t lookups, MakeError make_error) {
+  std::size_t total = 0;
+  for (std::int64_t i = 0; i < lookups; ++i) {
+    adt::Result<int, Message> lookup = make_error();
+    total += lookup.has_error() ? lookup.error().size() : 0;
+  }
+  return total;
+}
+
+void BM_ErrorMessagesHeap(benchmark::State &state) {
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(
+        failing_request<std::string>(state.range(0), [] {
+          return adt::Error(std::string(lookup_failure));
+        }));
+  });
+}
+
+void BM_ErrorMessagesArena(benchmark::State &state) {
+  bench::run_measured(state, [&] {
+    adt::ErrorArenaScope scope;
+    const auto allocator = scope.arena().allocator();
+    benchmark::DoNotOptimize(failing_request<std::pmr::string>(
+        state.range(0), [&] {
+          return adt::Error<std::pmr::string>(std::allocator_arg, allocator,
+                                              lookup_failure);
+        }));
+  });
+}
+
+BENCHMARK(BM_ErrorMessagesHeap)->Arg(8)->Arg(64);
+BENCHMARK(BM_ErrorMessagesArena)->Arg(8)->Arg(64);
+
+// An expensive lookup whose outcome is read for Arg(0) percent of the keys
+adt::Result<std::string, int> resolve(std::uint32_t key) {
+  if (key % 97 == 0) {
+    return adt::Error(static_cast<int>(key));
+  }
+  std::string value(48, 'a');
+  for (char &c : value) {
+    c = static_cast<char>('a' + (key = key * 1103515245u + 12345u) % 26);
+  }
+  return adt::Ok(std::move(value));
+}
+
+template <typename Lookup>
+void run_lookups(benchmark::State &state, Lookup lookup) {
+  const auto needed = bench::make_flags(state.range(0) / 100.0);
+  std::uint32_t key = 0;
+  bench::run_measured(state, [&] {
+    const std::size_t at = key % bench::sample_size;
+    benchmark::DoNotOptimize(lookup(key++, needed[at]));
+  });
+}
+
+void BM_LookupEager(benchmark::State &state) {
+  run_lookups(state, [](std::uint32_t key, bool needed) {
+    const auto resolved = resolve(key);
+    return needed && resolved.has_value() ? resolved.value().size() : 0;
+  });
+}
+
+void BM_LookupLazy(benchmark::State &state) {
+  run_lookups(state, [](std::uint32_t key, bool needed) {
+    const adt::LazyResult resolved([key] { return resolve(key); });
+    return needed && resolved.has_value() ? resolved.value().size() : 0;
+  });
+}
+
+BENCHMARK(BM_LookupEager)->Arg(5)->Arg(100);
+BENCHMARK(BM_LookupLazy)->Arg(5)->Arg(100);
+
+// Reads of an already evaluated SharedLazyResult: one acquire load each
+void BM_SharedLazyRead(benchmark::State &state) {
+  static const adt::SharedLazyResult config([] { return resolve(1); });
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::Inspect(
+        config, [](const std::string &value) { return value.size(); },
+        [](int) { return std::size_t{0}; }));
+  });
+}
+
+BENCHMARK(BM_SharedLazyRead)->Threads(1)->Threads(4);
+
+} // namespace
@@ -0,0 +1,193 @@
+/**
+ * @file serialize_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares adt::serialize with a hand-written encoder that branches on
+ *        every alternative and goes through an intermediate std::vector, and
+ *        reading through a WireView with deserialize followed by Inspect and
+ *        with a hand-written decoder.
+ * @version 0.1
+ * @date 2026-01-11
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include <cstring>
+
+#include "serialize.hh"
+
+namespace {
+
+struct Tick {
+  std::uint64_t timestamp;
+  double price;
+};
+struct Trade {
+  std::uint64_t id;
+  std::uint32_t quantity;
+  std::uint32_t venue;
+  double price;
+};
+struct Heartbeat {};
+
+using Event = std::variant<Tick, Trade, Heartbeat>;
+
+} // namespace
+
+// Both hold a double, so their lack of padding has to be stated
+template <> struct adt::is_padding_free<Tick> : std::true_type {};
+template <> struct adt::is_padding_free<Trade> : std::true_type {};
+
+namespace {
+
+std::vector<Event> make_events() {
+  std::vector<Event> events;
+  events.reserve(bench::sample_size);
+  for (std::uint32_t i = 0; i < bench::sample_size; ++i) {
+    const std::uint32_t seed = (i * 2654435761u) >> 16;
+    if (seed % 3 == 0) {
+      events.emplace_back(Tick{seed, seed * 0.5});
+    } else if (seed % 3 == 1) {
+      events.emplace_back(Trade{seed, seed % 100, seed % 7, seed * 0.25});
+    } else {
+      events.emplace_back(Heartbeat{});
+    }
+  }
+  return events;
+}
+
+// --- Hand-written baselines, as written per service ---
+template <typename T>
+void append(std::vector<std::byte> &out, const T &value) {
+  const auto *bytes = reinterpret_cast<const std::byte *>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+std::size_t encode_by_hand(const Event &event, std::byte *buffer,
+                           std::size_t capacity) {
+  std::vector<std::byte> message;
+  if (const auto *tick = std::get_if<Tick>(&event)) {
+    message.push_back(std::byte{0});
+    append(message, *tick);
+  } else if (const auto *trade = std::get_if<Trade>(&event)) {
+    message.push_back(std::byte{1});
+    append(message, *trade);
+  } else {
+    message.push_back(std::byte{2});
+  }
+  if (message.size() > capacity) {
+    return 0;
+  }
+  std::memcpy(buffer, message.data(), message.size());
+  return message.size();
+}
+
+template <typename T> T read_by_hand(const std::byte *in) {
+  T value;
+  std::memcpy(&value, in, sizeof(T));
+  return value;
+}
+
+// What a handler does with an event: depends on every field read
+double consume(const Tick &tick) {
+  return tick.price + static_cast<double>(tick.timestamp);
+}
+double consume(const Trade &trade) {
+  return trade.price * trade.quantity + static_cast<double>(trade.id);
+}
+double consume(Heartbeat) { return 1.0; }
+
+std::vector<std::byte> make_stream(const std::vector<Event> &events) {
+  std::vector<std::byte> stream(events.size() *
+                                adt::max_serialized_size_v<Event>);
+  std::size_t used = 0;
+  for (const Event &event : events) {
+    used += adt::serialize(event, stream.data() + used, stream.size() - used)
+                .value();
+  }
+  stream.resize(used);
+  return stream;
+}
+
+void BM_EncodeByHand(benchmark::State &state) {
+  const auto events = make_events();
+  std::vector<std::byte> out(adt::max_serialized_size_v<Event>);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(encode_by_hand(events[i++ % bench::sample_size],
+                                            out.data(), out.size()));
+    benchmark::ClobberMemory();
+  });
+}
+
+void BM_EncodeSerialize(benchmark::State &state) {
+  const auto events = make_events();
+  std::vector<std::byte> out(adt::max_serialized_size_v<Event>);
+  std::size_t i = 0;
+  bench::run_measured(state, [&] {
+    benchmark::DoNotOptimize(adt::serialize(events[i++ % bench::sample_size],
+                                            out.data(), out.size()));
+    benchmark::ClobberMemory();
+  });
+}
+
+BENCHMARK(BM_EncodeByHand);
+BENCHMARK(BM_EncodeSerialize);
+
+// --- Reading a stream of messages, one message per iteration ---
+template <typename Read> void run_stream(benchmark::State &state, Read read) {
+  const auto stream = make_stream(make_events());
+  std::size_t at = 0;
+  bench::run_measured(state, [&] {
+    if (at == stream.size()) {
+      at = 0;
+    }
+    double value = 0;
+    at += read(stream.data() + at, stream.size() - at, value);
+    benchmark::DoNotOptimize(value);
+  });
+}
+
+void BM_DecodeByHand(benchmark::State &state) {
+  run_stream(state, [](const std::byte *in, std::size_t, double &value) {
+    switch (static_cast<int>(in[0])) {
+    case 0:
+      value = consume(read_by_hand<Tick>(in + 1));
+      return 1 + sizeof(Tick);
+    case 1:
+      value = consume(read_by_hand<Trade>(in + 1));
+      return 1 + sizeof(Trade);
+    default:
+      value = consume(Heartbeat{});
+      return std::size_t{1};
+    }
+  });
+}
+
+void BM_DeserializeInspect(benchmark::State &state) {
+  run_stream(state, [](const std::byte *in, std::size_t size, double &value) {
+    const auto event = adt::deserialize<Event>(in, size).value();
+    value = adt::Inspect(event,
+                         [](const auto &alternative) {
+                           return consume(alternative);
+                         });
+    return adt::serialized_size(event);
+  });
+}
+
+void BM_WireViewInspect(benchmark::State &state) {
+  run_stream(state, [](const std::byte *in, std::size_t size, double &value) {
+    const auto view = adt::view_as<Event>(in, size).value();
+    value = adt::Inspect(view, [](const auto &alternative) {
+      return consume(alternative);
+    });
+    return view.size();
+  });
+}
+
+BENCHMARK(BM_DecodeByHand);
+BENCHMARK(BM_DeserializeInspect);
+BENCHMARK(BM_WireViewInspect);
+
+} // namespace
@@ -0,0 +1,92 @@
+/**
+ * @file transition_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares a state machine stepped with Inspect followed by an
+ *        assignment of the new state with the same machine stepped with
+ *        adt::Transition, where states hand their buffer to the next one.
+ * @version 0.1
+ * @date 2026-01-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include "transition.hh"
+
+namespace {
+
+struct Header {
+  std::uint64_t fields[4];
+};
+
+struct Reading {
+  std::vector<char> buffer;
+  Header header;
+};
+struct Parsing {
+  std::vector<char> buffer;
+  Header header;
+  std::uint32_t offset;
+};
+struct Done {
+  std::vector<char> buffer;
+  Header header;
+  std::uint64_t checksum;
+};
+
+using Machine = std::variant<Reading, Parsing, Done>;
+
+Machine make_machine() { return Reading{std::vector<char>(4096), {}}; }
+
+// Cycles Reading -> Parsing (stays for 3 steps) -> Done -> Reading
+void BM_InspectAssign(benchmark::State &state) {
+  Machine machine = make_machine();
+  bench::run_measured(state, [&] {
+    machine = adt::Inspect<Machine>(
+        std::move(machine),
+        [](Reading &&reading) {
+          return Parsing{std::move(reading.buffer), reading.header, 0};
+        },
+        [](Parsing &&parsing) -> Machine {
+          if (parsing.offset < 3) {
+            return Parsing{std::move(parsing.buffer), parsing.header,
+                           parsing.offset + 1};
+          }
+          return Done{std::move(parsing.buffer), parsing.header,
+                      parsing.offset};
+        },
+        [](Done &&done) {
+          return Reading{std::move(done.buffer), done.header};
+        });
+    benchmark::DoNotOptimize(machine);
+  });
+}
+
+void BM_Transition(benchmark::State &state) {
+  Machine machine = make_machine();
+  bench::run_measured(state, [&] {
+    adt::Transition(
+        machine,
+        [](Reading &&reading) {
+          return Parsing{std::move(reading.buffer), reading.header, 0};
+        },
+        [](Parsing &&parsing) -> adt::StayOr<Done> {
+          if (parsing.offset < 3) {
+            ++parsing.offset;
+            return adt::stay;
+          }
+          return Done{std::move(parsing.buffer), parsing.header,
+                      parsing.offset};
+        },
+        [](Done &&done) {
+          return Reading{std::move(done.buffer), done.header};
+        });
+    benchmark::DoNotOptimize(machine);
+  });
+}
+
+BENCHMARK(BM_InspectAssign);
+BENCHMARK(BM_Transition);
+
+} // namespace
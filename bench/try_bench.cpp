@@ -0,0 +1,138 @@
+/**
+ * @file try_bench.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Compares a 3-step fallible computation written with hand-written
+ *        early returns, ADT_TRY_ASSIGN, ADT_TRY and (in C++20) a Result
+ *        coroutine. The macros should compile to the same code as the
+ *        hand-written form; the coroutine shows up in allocs/op when its
+ *        frame is not elided.
+ * @version 0.1
+ * @date 2026-01-09
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "bench_support.hh"
+
+#include "try.hh"
+
+namespace {
+
+enum class StepError : std::uint8_t { NEGATIVE, TOO_LARGE, ODD };
+
+using Step = adt::Result<std::int32_t, StepError>;
+
+Step require_positive(std::int32_t value) {
+  if (value < 0) {
+    return adt::Error(StepError::NEGATIVE);
+  }
+  return adt::Ok(value);
+}
+
+Step double_checked(std::int32_t value) {
+  if (value > (1 << 29)) {
+    return adt::Error(StepError::TOO_LARGE);
+  }
+  return adt::Ok(value * 2);
+}
+
+Step halve_even(std::int32_t value) {
+  if (value % 4 != 0) {
+    return adt::Error(StepError::ODD);
+  }
+  return adt::Ok(value / 4);
+}
+
+Step steps_early_return(std::int32_t input) {
+  Step positive = require_positive(input);
+  if (!positive.has_value()) {
+    return adt::Error(positive.error());
+  }
+  Step doubled = double_checked(*positive);
+  if (!doubled.has_value()) {
+    return adt::Error(doubled.error());
+  }
+  Step halved = halve_even(*doubled);
+  if (!halved.has_value()) {
+    return adt::Error(halved.error());
+  }
+  return adt::Ok(*halved + 1);
+}
+
+Step steps_try_assign(std::int32_t input) {
+  ADT_TRY_ASSIGN(std::int32_t positive, require_positive(input));
+  ADT_TRY_ASSIGN(std::int32_t doubled, double_checked(positive));
+  ADT_TRY_ASSIGN(std::int32_t halved, halve_even(doubled));
+  return adt::Ok(halved + 1);
+}
+
+#if defined(ADT_TRY)
+Step steps_try(std::int32_t input) {
+  return adt::Ok(
+      ADT_TRY(halve_even(ADT_TRY(double_checked(
+          ADT_TRY(require_positive(input)))))) +
+      1);
+}
+#endif
+
+#if ADT_RESULT_COROUTINES
+Step steps_coroutine(std::int32_t input) {
+  const std::int32_t positive = co_await require_positive(input);
+  const std::int32_t doubled = co_await double_checked(positive);
+  const std::int32_t halved = co_await halve_even(doubled);
+  co_return adt::Ok(halved + 1);
+}
+#endif
+
+// Arg(0) is the percentage of inputs that pass every step
+std::vector<std::int32_t> make_inputs(benchmark::State &state) {
+  const auto flags = bench::make_flags(static_cast<double>(state.range(0)) /
+                                       100.0);
+  std::vector<std::int32_t> inputs;
+  inputs.reserve(flags.size());
+  for (std::size_t i = 0; i < flags.size(); ++i) {
+    const auto value = static_cast<std::int32_t>(i);
+    inputs.push_back(flags[i] ? value * 2 : -value - 1);
+  }
+  return inputs;
+}
+
+template <typename Steps>
+void run_steps(benchmark::State &state, Steps steps) {
+  const auto inputs = make_inputs(state);
+  bench::run_measured(state, [&] {
+    std::int64_t sum = 0;
+    for (std::int32_t input : inputs) {
+      const Step result = steps(input);
+      sum += result.has_value() ? *result : -1;
+    }
+    benchmark::DoNotOptimize(sum);
+  });
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(inputs.size()));
+}
+
+void BM_StepsEarlyReturn(benchmark::State &state) {
+  run_steps(state, steps_early_return);
+}
+
+void BM_StepsTryAssign(benchmark::State &state) {
+  run_steps(state, steps_try_assign);
+}
+
+BENCHMARK(BM_StepsEarlyReturn)->Arg(100)->Arg(50);
+BENCHMARK(BM_StepsTryAssign)->Arg(100)->Arg(50);
+
+#if defined(ADT_TRY)
+void BM_StepsTry(benchmark::State &state) { run_steps(state, steps_try); }
+BENCHMARK(BM_StepsTry)->Arg(100)->Arg(50);
+#endif
+
+#if ADT_RESULT_COROUTINES
+void BM_StepsCoroutine(benchmark::State &state) {
+  run_steps(state, steps_coroutine);
+}
+BENCHMARK(BM_StepsCoroutine)->Arg(100)->Arg(50);
+#endif
+
+} // namespace
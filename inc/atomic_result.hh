@@ -0,0 +1,397 @@
+/**
+ * @file atomic_result.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides AtomicResult and AtomicOptional, lock-free slots that pack
+ *        a small Result or Optional (tag and payload) into one std::atomic
+ *        word, so status values can be published between threads without a
+ *        mutex.
+ * @version 0.1
+ * @date 2026-01-13
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "inspect.hh"
+#include "niche.hh"
+#include "optional.hh"
+#include "result.hh"
+
+namespace adt {
+
+namespace detail {
+
+/**
+ * @brief The bytes a payload takes in an atomic word: none for void and
+ *        empty types, which are rebuilt from nothing.
+ */
+template <typename T, typename = void>
+struct slot_size : std::integral_constant<std::size_t, sizeof(T)> {};
+
+template <> struct slot_size<void> : std::integral_constant<std::size_t, 0> {};
+
+template <typename T>
+struct slot_size<T, std::enable_if_t<std::is_empty_v<T>>>
+    : std::integral_constant<std::size_t, 0> {};
+
+template <typename T>
+inline constexpr bool slot_payload_v =
+    std::is_void_v<T> || (std::is_trivially_copyable_v<T> &&
+                          std::is_default_constructible_v<T>);
+
+/**
+ * @brief Whether equal values of T always have equal bytes, so comparing
+ *        encoded words compares values. Floating-point payloads compare
+ *        bitwise, as with std::atomic<double>.
+ */
+template <typename T>
+inline constexpr bool bitwise_comparable_v =
+    slot_size<T>::value == 0 || std::has_unique_object_representations_v<T> ||
+    std::is_floating_point_v<T>;
+
+/**
+ * @brief Two machine words, for payloads of up to 15 bytes on targets with
+ *        a 16-byte compare-exchange.
+ */
+struct alignas(16) wide_word {
+  std::uint64_t low;
+  std::uint64_t high;
+};
+
+// clang-format off
+template <std::size_t Bytes>
+using atomic_word_t =
+    std::conditional_t<Bytes <= 1, std::uint8_t,
+    std::conditional_t<Bytes <= 2, std::uint16_t,
+    std::conditional_t<Bytes <= 4, std::uint32_t,
+    std::conditional_t<Bytes <= 8, std::uint64_t, wide_word>>>>;
+// clang-format on
+
+/**
+ * @brief Byte-level access to a word. The unused bytes stay zero, so a
+ *        value always encodes to the same word.
+ */
+template <typename Word> struct word_bytes {
+  unsigned char bytes[sizeof(Word)] = {};
+
+  template <typename T> void store(std::size_t at, const T &value) noexcept {
+    if constexpr (slot_size<T>::value != 0) {
+      std::memcpy(bytes + at, std::addressof(value), sizeof(T));
+    }
+  }
+
+  template <typename T> T load(std::size_t at) const noexcept {
+    T value{};
+    if constexpr (slot_size<T>::value != 0) {
+      std::memcpy(std::addressof(value), bytes + at, sizeof(T));
+    }
+    return value;
+  }
+
+  Word word() const noexcept {
+    Word word;
+    std::memcpy(&word, bytes, sizeof(Word));
+    return word;
+  }
+
+  static word_bytes of(const Word &word) noexcept {
+    word_bytes out;
+    std::memcpy(out.bytes, &word, sizeof(Word));
+    return out;
+  }
+};
+
+/**
+ * @brief The word layout of a Result<T, E>: the value or the error at byte
+ *        0, followed by the tag (0 for a value, 1 for an error).
+ */
+template <typename T, typename E> struct result_codec {
+  static_assert(slot_payload_v<T> && slot_payload_v<E>,
+                "❌ ATOMIC ERROR: the value and the error of an AtomicResult "
+                "must be trivially copyable and default constructible!");
+
+  using value_type = Result<T, E>;
+
+  static constexpr std::size_t payload_size =
+      slot_size<T>::value > slot_size<E>::value ? slot_size<T>::value
+                                                : slot_size<E>::value;
+  static constexpr std::size_t size = payload_size + 1;
+  static constexpr bool bitwise_comparable =
+      bitwise_comparable_v<T> && bitwise_comparable_v<E>;
+
+  using word = atomic_word_t<size>;
+
+  static word encode(const value_type &result) noexcept {
+    word_bytes<word> out;
+    if (result.has_value()) {
+      if constexpr (!std::is_void_v<T>) {
+        out.store(0, *result);
+      }
+    } else {
+      out.bytes[payload_size] = 1;
+      if constexpr (std::is_same_v<T, E>) {
+        out.store(0, result.unsafe_error().get());
+      } else {
+        out.store(0, result.unsafe_error());
+      }
+    }
+    return out.word();
+  }
+
+  static value_type decode(const word &encoded) noexcept {
+    const auto in = word_bytes<word>::of(encoded);
+    if (in.bytes[payload_size] != 0) {
+      return value_type(Error<E>(in.template load<E>(0)));
+    }
+    if constexpr (std::is_void_v<T>) {
+      return value_type(Ok<void>{});
+    } else {
+      return value_type(Ok<T>(in.template load<T>(0)));
+    }
+  }
+};
+
+/**
+ * @brief The word layout of an Optional<T>. Types with a niche store the
+ *        sentinel when empty and need no tag, as adt::Optional itself does;
+ *        other types are followed by a tag byte (1 when engaged).
+ */
+template <typename T> struct optional_codec {
+  static_assert(slot_payload_v<T> && !std::is_void_v<T>,
+                "❌ ATOMIC ERROR: the value of an AtomicOptional must be "
+                "trivially copyable and default constructible!");
+
+  using value_type = Optional<T>;
+
+  static constexpr bool compact = has_niche_v<T>;
+  static constexpr std::size_t size = slot_size<T>::value + (compact ? 0 : 1);
+  static constexpr bool bitwise_comparable = bitwise_comparable_v<T>;
+
+  using word = atomic_word_t<size>;
+
+  static word encode(const value_type &optional) noexcept {
+    word_bytes<word> out;
+    if constexpr (compact) {
+      out.store(0, optional.has_value() ? *optional
+                                        : niche_traits<T>::sentinel());
+    } else if (optional.has_value()) {
+      out.store(0, *optional);
+      out.bytes[slot_size<T>::value] = 1;
+    }
+    return out.word();
+  }
+
+  static value_type decode(const word &encoded) noexcept {
+    const auto in = word_bytes<word>::of(encoded);
+    if constexpr (compact) {
+      const T value = in.template load<T>(0);
+      if (niche_traits<T>::is_sentinel(value)) {
+        return std::nullopt;
+      }
+      return value;
+    } else {
+      if (in.bytes[slot_size<T>::value] == 0) {
+        return std::nullopt;
+      }
+      return in.template load<T>(0);
+    }
+  }
+};
+
+/**
+ * @brief The std::atomic interface over values encoded by Codec. Every
+ *        operation is one atomic operation on the encoded word.
+ */
+template <typename Codec> class atomic_slot {
+  using word = typename Codec::word;
+
+  static_assert(Codec::size <= sizeof(wide_word),
+                "❌ ATOMIC ERROR: the payload and its tag must fit in 16 "
+                "bytes!");
+  static_assert(std::atomic<word>::is_always_lock_free,
+                "❌ ATOMIC ERROR: this payload needs a lock-free atomic word "
+                "wider than the target provides (16-byte words need e.g. "
+                "-mcx16 with Clang). Keep the payload and its tag within 8 "
+                "bytes!");
+
+  std::atomic<word> _word;
+
+  static constexpr std::memory_order
+  failure_order(std::memory_order order) noexcept {
+    if (order == std::memory_order_acq_rel) {
+      return std::memory_order_acquire;
+    }
+    if (order == std::memory_order_release) {
+      return std::memory_order_relaxed;
+    }
+    return order;
+  }
+
+public:
+  using value_type = typename Codec::value_type;
+
+  static constexpr bool is_always_lock_free = true;
+
+  explicit atomic_slot(const value_type &initial) noexcept
+      : _word(Codec::encode(initial)) {}
+
+  atomic_slot(const atomic_slot &) = delete;
+  atomic_slot &operator=(const atomic_slot &) = delete;
+
+  /**
+   * @brief A snapshot of the current value.
+   */
+  [[nodiscard]] value_type
+  load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return Codec::decode(_word.load(order));
+  }
+
+  void store(const value_type &desired,
+             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    _word.store(Codec::encode(desired), order);
+  }
+
+  /**
+   * @brief Replaces the value, returning the previous one.
+   */
+  value_type
+  exchange(const value_type &desired,
+           std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return Codec::decode(_word.exchange(Codec::encode(desired), order));
+  }
+
+  /**
+   * @brief Replaces the value with `desired` if it equals `expected`;
+   *        otherwise loads the current value into `expected`.
+   *
+   * @details The encoded words are compared, so values compare by their
+   *          bytes, as with std::atomic. That is why payloads with padding
+   *          bits are rejected.
+   */
+  bool compare_exchange_strong(value_type &expected,
+                               const value_type &desired,
+                               std::memory_order success,
+                               std::memory_order failure) noexcept {
+    static_assert(Codec::bitwise_comparable,
+                  "❌ ATOMIC ERROR: compare_exchange needs payloads without "
+                  "padding bits, whose bytes identify their value!");
+    word current = Codec::encode(expected);
+    if (_word.compare_exchange_strong(current, Codec::encode(desired),
+                                      success, failure)) {
+      return true;
+    }
+    expected = Codec::decode(current);
+    return false;
+  }
+
+  bool compare_exchange_strong(
+      value_type &expected, const value_type &desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return compare_exchange_strong(expected, desired, order,
+                                   failure_order(order));
+  }
+
+  /**
+   * @brief As compare_exchange_strong, but may fail spuriously; use it in a
+   *        retry loop.
+   */
+  bool compare_exchange_weak(value_type &expected, const value_type &desired,
+                             std::memory_order success,
+                             std::memory_order failure) noexcept {
+    static_assert(Codec::bitwise_comparable,
+                  "❌ ATOMIC ERROR: compare_exchange needs payloads without "
+                  "padding bits, whose bytes identify their value!");
+    word current = Codec::encode(expected);
+    if (_word.compare_exchange_weak(current, Codec::encode(desired), success,
+                                    failure)) {
+      return true;
+    }
+    expected = Codec::decode(current);
+    return false;
+  }
+
+  bool compare_exchange_weak(
+      value_type &expected, const value_type &desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return compare_exchange_weak(expected, desired, order,
+                                 failure_order(order));
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief A Result<T, E> shared between threads without a lock: the tag and
+ *        the payload are packed into one std::atomic word (up to 8 bytes,
+ *        or 16 where the target has a lock-free 16-byte word).
+ *
+ * @details T and E must be trivially copyable; void and empty types take
+ *          no bytes. load() returns a snapshot Result, which Inspect can
+ *          match on directly.
+ *
+ * @note Usage:
+ * ```cpp
+ * adt::AtomicResult<std::uint32_t, ErrorCode> status{adt::Ok(0u)};
+ * status.store(adt::Error(ErrorCode::TIMEOUT), std::memory_order_release);
+ * adt::Inspect(status, [](std::uint32_t progress) { ... },
+ *              [](ErrorCode code) { ... });
+ * ```
+ */
+template <typename T, typename E>
+class AtomicResult
+    : public detail::atomic_slot<detail::result_codec<T, E>> {
+public:
+  using detail::atomic_slot<detail::result_codec<T, E>>::atomic_slot;
+};
+
+/**
+ * @brief An Optional<T> shared between threads without a lock. Types with
+ *        a niche encode the empty state as their sentinel, so for instance
+ *        an AtomicOptional of a 4-byte niche type is a plain 4-byte atomic.
+ *
+ * @details Starts out empty unless given a value.
+ */
+template <typename T>
+class AtomicOptional : public detail::atomic_slot<detail::optional_codec<T>> {
+  using base = detail::atomic_slot<detail::optional_codec<T>>;
+
+public:
+  using base::atomic_slot;
+
+  AtomicOptional() noexcept : base(std::nullopt) {}
+};
+
+/**
+ * @brief Matches on a snapshot of the slot, loaded with acquire ordering so
+ *        that what the publishing thread wrote before its release store is
+ *        visible to the handlers.
+ */
+template <typename R = detail::deduce_return_type, typename T, typename E,
+          typename... Lambdas>
+[[nodiscard]] auto
+Inspect(const AtomicResult<T, E> &slot, Lambdas &&...lambdas) noexcept(
+    detail::nothrow_inspect<R, std::tuple<Result<T, E> &&>, Lambdas...>()) {
+  return Inspect<R>(slot.load(std::memory_order_acquire),
+                    std::forward<Lambdas>(lambdas)...);
+}
+
+template <typename R = detail::deduce_return_type, typename T,
+          typename... Lambdas>
+[[nodiscard]] auto
+Inspect(const AtomicOptional<T> &slot, Lambdas &&...lambdas) noexcept(
+    detail::nothrow_inspect<R, std::tuple<Optional<T> &&>, Lambdas...>()) {
+  return Inspect<R>(slot.load(std::memory_order_acquire),
+                    std::forward<Lambdas>(lambdas)...);
+}
+
+} // namespace adt
@@ -0,0 +1,115 @@
+/**
+ * @file error_arena.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides ErrorArena, a per-thread monotonic memory resource for the
+ *        heap-owning payloads built on the failure path (messages, context
+ *        chains), released all at once at the end of a request.
+ * @version 0.1
+ * @date 2026-01-10
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace adt {
+
+/**
+ * @brief A monotonic std::pmr resource owned by the calling thread. Every
+ *        allocation is a pointer bump; deallocation is a no-op and the
+ *        memory comes back in one go with release().
+ *
+ * @details The first 4 KiB come from a buffer inside the arena itself, later
+ *          blocks from the upstream resource (the heap by default). After a
+ *          release() the arena starts again from its inline buffer.
+ *
+ * @warning Every object allocated from the arena must be dead before
+ *          release(). Use ErrorArenaScope to tie it to the scope of a request.
+ *
+ * @note Usage:
+ * ```cpp
+ * using Message = std::pmr::string;
+ *
+ * adt::Result<Reply, Message> handle(const Request &request) {
+ *   if (!request.valid()) {
+ *     return adt::Error<Message>(std::allocator_arg,
+ *                                adt::ErrorArena::local().allocator(),
+ *                                "malformed request");
+ *   }
+ *   ...
+ * }
+ *
+ * void serve(const Request &request) {
+ *   adt::ErrorArenaScope scope; // releases the messages of this request
+ *   adt::Inspect(handle(request), ...);
+ * }
+ * ```
+ */
+class ErrorArena {
+public:
+  static constexpr std::size_t inline_capacity = 4096;
+
+  /**
+   * @brief The arena of the calling thread.
+   */
+  [[nodiscard]] static ErrorArena &local() noexcept {
+    thread_local ErrorArena arena;
+    return arena;
+  }
+
+  ErrorArena(const ErrorArena &) = delete;
+  ErrorArena &operator=(const ErrorArena &) = delete;
+
+  [[nodiscard]] std::pmr::memory_resource *resource() noexcept {
+    return &_resource;
+  }
+
+  template <typename T = std::byte>
+  [[nodiscard]] std::pmr::polymorphic_allocator<T> allocator() noexcept {
+    return std::pmr::polymorphic_allocator<T>(&_resource);
+  }
+
+  /**
+   * @brief Frees everything allocated from the arena since the last release.
+   */
+  void release() noexcept { _resource.release(); }
+
+private:
+  friend class ErrorArenaScope;
+
+  explicit ErrorArena(
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+      : _resource(_buffer, sizeof(_buffer), upstream) {}
+
+  alignas(std::max_align_t) std::byte _buffer[inline_capacity];
+  std::pmr::monotonic_buffer_resource _resource;
+  std::size_t _scopes = 0;
+};
+
+/**
+ * @brief Releases the arena of the calling thread when the outermost scope
+ *        ends, so nested helpers may open their own scopes safely.
+ */
+class ErrorArenaScope {
+public:
+  ErrorArenaScope() noexcept : _arena(ErrorArena::local()) { ++_arena._scopes; }
+
+  ErrorArenaScope(const ErrorArenaScope &) = delete;
+  ErrorArenaScope &operator=(const ErrorArenaScope &) = delete;
+
+  ~ErrorArenaScope() {
+    if (--_arena._scopes == 0) {
+      _arena.release();
+    }
+  }
+
+  [[nodiscard]] ErrorArena &arena() const noexcept { return _arena; }
+
+private:
+  ErrorArena &_arena;
+};
+
+} // namespace adt
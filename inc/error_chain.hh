@@ -0,0 +1,326 @@
+/**
+ * @file error_chain.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides ErrorChain, an error with the contexts added by every
+ *        layer it went through. Contexts are string literals interned into
+ *        a static table of chain nodes, so the chain itself is the error
+ *        plus a 16-bit node id: no allocation, no formatting until logged.
+ * @version 0.1
+ * @date 2026-01-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+#include "hints.hh"
+#include "niche.hh"
+#include "result.hh"
+
+/**
+ * @brief Number of distinct (outer context, inner chain) nodes the program
+ *        can intern, at most 65534. Every node takes 16 bytes of static
+ *        storage. Contexts attached once the table is full are only counted.
+ */
+#ifndef ADT_ERROR_CONTEXT_NODES
+#define ADT_ERROR_CONTEXT_NODES 1024
+#endif
+
+/**
+ * @brief Makes the ErrorContext of a string literal. Anything else, such as
+ *        a char array on the stack, does not compile.
+ */
+#define ADT_CONTEXT(literal) (::adt::ErrorContext::from_literal("" literal))
+
+namespace adt {
+
+namespace detail {
+
+static_assert(ADT_ERROR_CONTEXT_NODES > 0 && ADT_ERROR_CONTEXT_NODES < 65535,
+              "❌ ERROR CHAIN ERROR: ADT_ERROR_CONTEXT_NODES must be between "
+              "1 and 65534!");
+
+/**
+ * @brief An interned context: its literal and the node of the chain it was
+ *        attached to (0 for none). Written once, when first claimed.
+ */
+struct context_node {
+  enum : std::uint32_t { FREE, WRITING, READY };
+
+  std::atomic<std::uint32_t> state{FREE};
+  std::uint16_t parent = 0;
+  std::uint16_t depth = 0;
+  const char *text = nullptr;
+};
+
+inline context_node context_nodes[ADT_ERROR_CONTEXT_NODES];
+
+/**
+ * @brief The id (index + 1) of the node attaching `text` to the chain
+ *        `parent`, claimed with a lock-free insert the first time the pair
+ *        is seen. 0 when the table is full.
+ */
+ADT_COLD inline std::uint16_t intern_context(std::uint16_t parent,
+                                             const char *text) noexcept {
+  constexpr std::size_t slots = ADT_ERROR_CONTEXT_NODES;
+  const auto key = reinterpret_cast<std::uintptr_t>(text) ^
+                   (static_cast<std::uintptr_t>(parent) * 0x9E3779B1u);
+  std::size_t slot = (key ^ (key >> 7)) % slots;
+
+  for (std::size_t probe = 0; probe < slots; ++probe) {
+    context_node &node = context_nodes[slot];
+    std::uint32_t state = node.state.load(std::memory_order_acquire);
+    if (state == context_node::FREE &&
+        node.state.compare_exchange_strong(state, context_node::WRITING,
+                                           std::memory_order_acquire)) {
+      node.parent = parent;
+      node.depth = static_cast<std::uint16_t>(
+          parent == 0 ? 1 : context_nodes[parent - 1].depth + 1);
+      node.text = text;
+      node.state.store(context_node::READY, std::memory_order_release);
+      return static_cast<std::uint16_t>(slot + 1);
+    }
+    // Lost the race for this slot: wait until its owner is done with it
+    while (state != context_node::READY) {
+      state = node.state.load(std::memory_order_acquire);
+    }
+    if (node.text == text && node.parent == parent) {
+      return static_cast<std::uint16_t>(slot + 1);
+    }
+    slot = slot + 1 == slots ? 0 : slot + 1;
+  }
+  return 0;
+}
+
+} // namespace detail
+
+/**
+ * @brief A context to attach to an ErrorChain, made with ADT_CONTEXT. The
+ *        chain keeps only the pointer, so the text must be a string literal:
+ *        valid, and unchanged, for the whole program.
+ */
+class ErrorContext {
+  const char *_text;
+
+  constexpr explicit ErrorContext(const char *text) noexcept : _text(text) {}
+
+public:
+  /**
+   * @brief Only for ADT_CONTEXT, which checks that `text` is a literal.
+   */
+  static constexpr ErrorContext from_literal(const char *text) noexcept {
+    return ErrorContext(text);
+  }
+
+  [[nodiscard]] constexpr const char *text() const noexcept { return _text; }
+};
+
+/**
+ * @brief An error E and the contexts attached to it on its way up, for use
+ *        as Result<T, ErrorChain<E>>. A context is a string literal,
+ *        passed through ADT_CONTEXT: attaching one interns the pair
+ *        (literal, chain so far) once per program and afterwards only
+ *        stores the id of that node, so an ErrorChain is E plus four bytes,
+ *        and Results of it stay as small.
+ *        Nothing is formatted until the chain is written to a stream.
+ *
+ * @note Usage:
+ * ```cpp
+ * adt::Result<Header, IoError> read_header(File &file);
+ *
+ * adt::Result<Config, adt::ErrorChain<IoError>> load(File &file) {
+ *   ADT_TRY_ASSIGN(auto header,
+ *                  adt::with_context(read_header(file),
+ *                                    ADT_CONTEXT("reading header")));
+ *   ...
+ * }
+ *
+ * adt::Inspect(adt::with_context(load(file),
+ *                                ADT_CONTEXT("loading the configuration")),
+ *              [](const Config &config) { apply(config); },
+ *              [](const adt::ErrorChain<IoError> &chain) {
+ *                std::cerr << chain << '\n'; // formatted only here
+ *              });
+ * ```
+ */
+template <typename E> class ErrorChain {
+  friend struct niche_traits<ErrorChain<E>>;
+
+  std::uint16_t _node = 0;
+  std::uint8_t _dropped = 0;
+  E _error;
+
+public:
+  using error_type = E;
+
+  constexpr ErrorChain(E error) noexcept(
+      std::is_nothrow_move_constructible_v<E>)
+      : _error(std::move(error)) {}
+
+  /**
+   * @brief Attaches a context, outside of those already attached.
+   */
+  ErrorChain &with_context(ErrorContext context) & noexcept(
+      std::is_nothrow_move_constructible_v<E> &&
+      std::is_nothrow_move_assignable_v<E>) {
+    *this = attached(std::move(*this), context.text());
+    return *this;
+  }
+
+  [[nodiscard]] ErrorChain with_context(ErrorContext context) && noexcept(
+      std::is_nothrow_move_constructible_v<E>) {
+    return attached(std::move(*this), context.text());
+  }
+
+  [[nodiscard]] constexpr E &error() & noexcept { return _error; }
+  [[nodiscard]] constexpr const E &error() const & noexcept { return _error; }
+  [[nodiscard]] constexpr E &&error() && noexcept { return std::move(_error); }
+
+  /**
+   * @brief The number of contexts attached, and of those that were not
+   *        kept because the node table was full.
+   */
+  [[nodiscard]] std::size_t depth() const noexcept {
+    return _node == 0 ? 0 : detail::context_nodes[_node - 1].depth;
+  }
+  [[nodiscard]] constexpr std::size_t dropped() const noexcept {
+    return _dropped;
+  }
+
+  /**
+   * @brief Calls `f(context)` for every kept context, outermost first.
+   */
+  template <typename F> void each_context(F &&f) const {
+    for (std::uint16_t at = _node; at != 0;) {
+      const detail::context_node &node = detail::context_nodes[at - 1];
+      f(static_cast<const char *>(node.text));
+      at = node.parent;
+    }
+  }
+
+  /**
+   * @brief Writes the contexts, outermost first, then the error through
+   *        `describe(out, error)`:
+   *        "loading the configuration: reading header: <error>".
+   */
+  template <typename Describe>
+  void format(std::ostream &out, Describe &&describe) const {
+    if (_dropped != 0) {
+      out << "(" << static_cast<unsigned>(_dropped) << " more): ";
+    }
+    each_context([&](const char *context) { out << context << ": "; });
+    std::forward<Describe>(describe)(out, _error);
+  }
+
+private:
+  // Out of line and by value: the chain is never addressed, so the caller
+  // can keep a Result of it in registers on its success path
+  ADT_COLD static ErrorChain attached(ErrorChain chain,
+                                      const char *context) noexcept(
+      std::is_nothrow_move_constructible_v<E>) {
+    const std::uint16_t node = detail::intern_context(chain._node, context);
+    if (ADT_LIKELY(node != 0)) {
+      chain._node = node;
+    } else if (chain._dropped < UINT8_MAX) {
+      ++chain._dropped;
+    }
+    return chain;
+  }
+};
+
+/**
+ * @brief The node id past the table is the niche of an ErrorChain, so a
+ *        Result of one needs no separate tag when E is trivially copyable:
+ *        Result<std::int32_t, ErrorChain<IoError>> is 8 bytes, returned in a
+ *        register.
+ */
+template <typename E> struct niche_traits<ErrorChain<E>> {
+  static constexpr bool available = std::is_trivially_copyable_v<E> &&
+                                    std::is_default_constructible_v<E>;
+
+  static constexpr ErrorChain<E> sentinel() noexcept {
+    ErrorChain<E> chain{E{}};
+    chain._node = UINT16_MAX;
+    return chain;
+  }
+  static constexpr bool is_sentinel(const ErrorChain<E> &chain) noexcept {
+    return chain._node == UINT16_MAX;
+  }
+};
+
+namespace detail {
+
+template <typename E> struct is_error_chain : std::false_type {};
+template <typename E> struct is_error_chain<ErrorChain<E>> : std::true_type {};
+
+template <typename E>
+using chained_t =
+    std::conditional_t<is_error_chain<E>::value, E, ErrorChain<E>>;
+
+template <typename Out, typename E, typename = void>
+struct is_streamable : std::false_type {};
+template <typename Out, typename E>
+struct is_streamable<
+    Out, E, std::void_t<decltype(std::declval<Out &>() << std::declval<E>())>>
+    : std::true_type {};
+
+/**
+ * @brief Writes an error: with its operator<< when it has one, as its
+ *        underlying value for an enumeration.
+ */
+struct describe_error {
+  template <typename E>
+  void operator()(std::ostream &out, const E &error) const {
+    if constexpr (is_streamable<std::ostream, const E &>::value) {
+      out << error;
+    } else {
+      static_assert(std::is_enum_v<E>,
+                    "❌ ERROR CHAIN ERROR: the error has no operator<<; use "
+                    "ErrorChain::format with a function describing it!");
+      out << +static_cast<std::underlying_type_t<E>>(error);
+    }
+  }
+};
+
+} // namespace detail
+
+template <typename E>
+std::ostream &operator<<(std::ostream &out, const ErrorChain<E> &chain) {
+  chain.format(out, detail::describe_error{});
+  return out;
+}
+
+/**
+ * @brief Attaches a context to the error of a Result, if it holds one. A
+ *        Result<T, E> becomes a Result<T, ErrorChain<E>>; a Result that
+ *        already holds an ErrorChain is extended in place. The value of a
+ *        successful Result is moved through untouched.
+ */
+template <typename T, typename E>
+Result<T, detail::chained_t<E>> with_context(Result<T, E> &&result,
+                                             ErrorContext context) {
+  if constexpr (detail::is_error_chain<E>::value) {
+    if (ADT_UNLIKELY(result.has_error())) {
+      if constexpr (std::is_same_v<T, E>) {
+        return Error<E>(
+            std::move(result.unsafe_error().get()).with_context(context));
+      } else {
+        return Error<E>(std::move(result.unsafe_error()).with_context(context));
+      }
+    }
+    return std::move(result);
+  } else {
+    return std::move(result).transform_error([&](E &&error) {
+      return ErrorChain<E>(std::move(error)).with_context(context);
+    });
+  }
+}
+
+} // namespace adt
@@ -0,0 +1,118 @@
+/**
+ * @file hints.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Branch and code-placement hints shared by the headers: likely and
+ *        unlikely conditions, cold out-of-line functions, and the single
+ *        noreturn failure path of the checked accessors, with its
+ *        configurable panic handler.
+ * @version 0.1
+ * @date 2026-01-10
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+/**
+ * @brief Tells the compiler which way a condition usually goes, so the other
+ *        branch is laid out away from the hot code. Usable in C++17, unlike
+ *        [[likely]] and [[unlikely]].
+ */
+#if defined(__GNUC__)
+#define ADT_LIKELY(...) (__builtin_expect(!!(__VA_ARGS__), 1))
+#define ADT_UNLIKELY(...) (__builtin_expect(!!(__VA_ARGS__), 0))
+#else
+#define ADT_LIKELY(...) (__VA_ARGS__)
+#define ADT_UNLIKELY(...) (__VA_ARGS__)
+#endif
+
+/**
+ * @brief Marks a function as rarely called and keeps it out of line, so its
+ *        code goes to the cold section (.text.unlikely).
+ */
+#if defined(__GNUC__)
+#define ADT_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define ADT_COLD __declspec(noinline)
+#else
+#define ADT_COLD
+#endif
+
+/**
+ * @brief 1 when the translation unit is compiled with exceptions. With
+ *        -fno-exceptions the headers have no throw path left: the failures
+ *        that would throw go to the panic handler instead. May be defined
+ *        to 0 beforehand to get that behaviour with exceptions enabled.
+ */
+#ifndef ADT_HAS_EXCEPTIONS
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+#define ADT_HAS_EXCEPTIONS 1
+#else
+#define ADT_HAS_EXCEPTIONS 0
+#endif
+#endif
+
+namespace adt {
+
+/**
+ * @brief Called with a description of a contract violation (value() of an
+ *        error, a valueless variant without exceptions...). It must not
+ *        return: the process is aborted if it does.
+ */
+using panic_handler = void (*)(const char *message) noexcept;
+
+namespace detail {
+
+inline std::atomic<panic_handler> installed_panic_handler{nullptr};
+
+} // namespace detail
+
+/**
+ * @brief Installs the handler called on contract violations, for example
+ *        to hand them to a crash reporter before the process stops, and
+ *        returns the previous one. nullptr restores the default: print the
+ *        message in debug builds, then std::abort().
+ */
+inline panic_handler set_panic_handler(panic_handler handler) noexcept {
+  return detail::installed_panic_handler.exchange(handler,
+                                                  std::memory_order_acq_rel);
+}
+
+} // namespace adt
+
+namespace adt::detail {
+
+/**
+ * @brief The failure path of value(), error() and friends: calls the panic
+ *        handler, or reports the message in debug builds and aborts. Out of
+ *        line and cold, so the callers only keep a test and a call in their
+ *        hot code, and no unwinding is involved.
+ */
+[[noreturn]] ADT_COLD inline void abort_with(const char *message) noexcept {
+  if (const panic_handler handler =
+          installed_panic_handler.load(std::memory_order_acquire)) {
+    handler(message);
+  } else {
+#ifndef NDEBUG
+    std::fprintf(stderr, "%s\n", message);
+#else
+    static_cast<void>(message);
+#endif
+  }
+  std::abort();
+}
+
+/**
+ * @brief Calls `f` from a cold, out-of-line frame, which moves the code of
+ *        `f` (inlined here) out of the hot block of the caller.
+ */
+template <typename F> ADT_COLD constexpr decltype(auto) cold_invoke(F &&f) {
+  return std::forward<F>(f)();
+}
+
+} // namespace adt::detail
@@ -13,12 +13,68 @@
 
 #include <concepts>
 #include <optional>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <variant>
 
+#include "hints.hh"
+
+/**
+ * @brief When 1, Inspect checks the coverage of a variant with a single fold
+ *        over its alternative types and only falls back to the detailed,
+ *        per-alternative validator to report a missing handler. This saves
+ *        compile time with large variants. Defaults to 1 when concepts are
+ *        available, define it to 0 or 1 to override.
+ */
+#ifndef ADT_INSPECT_FAST_COMPILE
+#if defined(__cpp_concepts)
+#define ADT_INSPECT_FAST_COMPILE 1
+#else
+#define ADT_INSPECT_FAST_COMPILE 0
+#endif
+#endif
+
+/**
+ * @brief When 1, the Inspect overloads are constrained with the concepts
+ *        below instead of std::enable_if_t. Defaults to 1 when concepts are
+ *        available, i.e. in C++20.
+ */
+#ifndef ADT_INSPECT_CONCEPTS
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+#define ADT_INSPECT_CONCEPTS 1
+#else
+#define ADT_INSPECT_CONCEPTS 0
+#endif
+#endif
+
+/**
+ * @brief When 1, every Inspect call site counts how often it dispatches to
+ *        each alternative (variant index, optional value or empty, Result ok
+ *        or error) with relaxed atomics, and adt::profile::dump() reports
+ *        the counts; see profile.hh. Defaults to 0, which compiles the
+ *        counters out entirely.
+ */
+#ifndef ADT_INSPECT_PROFILE
+#define ADT_INSPECT_PROFILE 0
+#endif
+
+#if ADT_INSPECT_PROFILE
+#include "profile.hh"
+#define ADT_INSPECT_COUNT(Kind, Adt, Visitor, N, Index)                        \
+  do {                                                                         \
+    if (!ADT_IS_CONSTANT_EVALUATED()) {                                        \
+      ::adt::detail::profile::hit<Kind, Adt, Visitor, N>(Index);               \
+    }                                                                          \
+  } while (false)
+#else
+#define ADT_INSPECT_COUNT(Kind, Adt, Visitor, N, Index) static_cast<void>(0)
+#endif
+
 namespace adt {
 
+template <typename T> class Optional;
+
 template <class... Ts> struct overloaded : Ts... {
   using Ts::operator()...;
 };
@@ -35,8 +91,719 @@ template <typename T> struct remove_cvref {
 };
 template <typename T> using remove_cvref_t = typename remove_cvref<T>::type;
 
+/**
+ * @brief Applies the const and reference qualifiers of From to To, like the
+ *        return type of std::get<To>(std::declval<From>()).
+ */
+template <typename From, typename To> struct copy_cvref {
+  using Qualified =
+      std::conditional_t<std::is_const_v<std::remove_reference_t<From>>,
+                         const To, To>;
+  using type = std::conditional_t<std::is_lvalue_reference_v<From>,
+                                  Qualified &, Qualified &&>;
+};
+template <typename From, typename To>
+using copy_cvref_t = typename copy_cvref<From, To>::type;
+
+/**
+ * @brief Whether `Check<Alternative>` holds for all the alternatives of a
+ *        variant, each qualified like Variant, computed with a single fold
+ *        over the type list instead of one std::get per index.
+ */
+template <template <typename> class Check, typename Variant,
+          typename Raw = remove_cvref_t<Variant>>
+struct all_alternatives;
+
+template <template <typename> class Check, typename Variant, typename... Ts>
+struct all_alternatives<Check, Variant, std::variant<Ts...>>
+    : std::bool_constant<(Check<copy_cvref_t<Variant, Ts>>::value && ...)> {
+};
+
+template <typename Visitor> struct invocable_by {
+  template <typename Arg> using check = std::is_invocable<Visitor, Arg>;
+};
+
+/**
+ * @brief Largest number of alternatives dispatched through a `switch` on
+ *        `index()`. Bigger variants fall back to `std::visit`.
+ */
+inline constexpr std::size_t switch_dispatch_limit = 32;
+
+/**
+ * @brief Accesses the I-th alternative with the value category of the
+ *        variant, as std::get does, but without its throwing check: the
+ *        pointer from std::get_if is dereferenced untested, which lets the
+ *        compiler drop the index comparison once the caller has made it.
+ *
+ * @warning The caller must guarantee that `variant.index() == I`.
+ */
+template <std::size_t I, typename Variant>
+constexpr decltype(auto) get_alternative(Variant &&variant) noexcept {
+  using Alternative = copy_cvref_t<
+      Variant &&, std::variant_alternative_t<I, remove_cvref_t<Variant>>>;
+  return static_cast<Alternative>(*std::get_if<I>(&variant));
+}
+
+template <std::size_t I, typename Visitor, typename Variant>
+using alternative_result_t = std::invoke_result_t<
+    Visitor,
+    copy_cvref_t<Variant &&,
+                 std::variant_alternative_t<I, remove_cvref_t<Variant>>>>;
+
+/**
+ * @brief The result of visiting the variant, taken from its first
+ *        alternative; switch_visit checks that every other one agrees.
+ */
+template <typename Visitor, typename Variant>
+using visit_result_t = alternative_result_t<0, Visitor, Variant>;
+
+template <typename Visitor, typename Variant, std::size_t... Is>
+constexpr bool same_visit_results(std::index_sequence<Is...>) {
+  return (std::is_same_v<alternative_result_t<Is, Visitor, Variant>,
+                         visit_result_t<Visitor, Variant>> &&
+          ...);
+}
+
+/**
+ * @brief The failure path of a visit of a valueless variant: throws
+ *        std::bad_variant_access like std::visit, or calls the panic handler
+ *        when exceptions are disabled.
+ */
+[[noreturn]] ADT_COLD inline void bad_variant_access() {
+#if ADT_HAS_EXCEPTIONS
+  throw std::bad_variant_access{};
+#else
+  abort_with("Inspect: the variant is valueless by exception!");
+#endif
+}
+
+template <std::size_t I>
+using index_constant = std::integral_constant<std::size_t, I>;
+
+template <std::size_t N, typename F>
+using with_index_result_t = std::invoke_result_t<F, index_constant<0>>;
+
+/**
+ * @brief Calls `f(index_constant<index>{})` through a `switch`, so every case
+ *        can be inlined instead of being called through a function-pointer
+ *        table.
+ *
+ * @throws std::bad_variant_access when `index >= N`, which for a variant
+ *         means it is valueless_by_exception (the same as std::visit).
+ *         Without exceptions, the panic handler is called instead.
+ */
+template <std::size_t N, typename F>
+constexpr with_index_result_t<N, F> switch_with_index(std::size_t index,
+                                                      F &&f) {
+  static_assert(N <= switch_dispatch_limit,
+                "switch_with_index handles at most switch_dispatch_limit "
+                "cases");
+
+  switch (index) {
+#define ADT_INSPECT_SWITCH_CASE(I)                                             \
+  case I:                                                                      \
+    if constexpr (I < N) {                                                     \
+      return std::forward<F>(f)(index_constant<I>{});                          \
+    }                                                                          \
+    [[fallthrough]];
+
+    ADT_INSPECT_SWITCH_CASE(0)
+    ADT_INSPECT_SWITCH_CASE(1)
+    ADT_INSPECT_SWITCH_CASE(2)
+    ADT_INSPECT_SWITCH_CASE(3)
+    ADT_INSPECT_SWITCH_CASE(4)
+    ADT_INSPECT_SWITCH_CASE(5)
+    ADT_INSPECT_SWITCH_CASE(6)
+    ADT_INSPECT_SWITCH_CASE(7)
+    ADT_INSPECT_SWITCH_CASE(8)
+    ADT_INSPECT_SWITCH_CASE(9)
+    ADT_INSPECT_SWITCH_CASE(10)
+    ADT_INSPECT_SWITCH_CASE(11)
+    ADT_INSPECT_SWITCH_CASE(12)
+    ADT_INSPECT_SWITCH_CASE(13)
+    ADT_INSPECT_SWITCH_CASE(14)
+    ADT_INSPECT_SWITCH_CASE(15)
+    ADT_INSPECT_SWITCH_CASE(16)
+    ADT_INSPECT_SWITCH_CASE(17)
+    ADT_INSPECT_SWITCH_CASE(18)
+    ADT_INSPECT_SWITCH_CASE(19)
+    ADT_INSPECT_SWITCH_CASE(20)
+    ADT_INSPECT_SWITCH_CASE(21)
+    ADT_INSPECT_SWITCH_CASE(22)
+    ADT_INSPECT_SWITCH_CASE(23)
+    ADT_INSPECT_SWITCH_CASE(24)
+    ADT_INSPECT_SWITCH_CASE(25)
+    ADT_INSPECT_SWITCH_CASE(26)
+    ADT_INSPECT_SWITCH_CASE(27)
+    ADT_INSPECT_SWITCH_CASE(28)
+    ADT_INSPECT_SWITCH_CASE(29)
+    ADT_INSPECT_SWITCH_CASE(30)
+    ADT_INSPECT_SWITCH_CASE(31)
+
+#undef ADT_INSPECT_SWITCH_CASE
+
+  default:
+    bad_variant_access();
+  }
+}
+
+template <std::size_t I, typename F>
+constexpr with_index_result_t<I + 1, F> invoke_with_index(F &f) {
+  return std::forward<F>(f)(index_constant<I>{});
+}
+
+/**
+ * @brief Calls `f(index_constant<index>{})` through a function-pointer table,
+ *        for index ranges above `switch_dispatch_limit`.
+ */
+template <typename F, std::size_t... Is>
+constexpr with_index_result_t<sizeof...(Is), F>
+table_with_index(std::size_t index, F &f, std::index_sequence<Is...>) {
+  using Entry = with_index_result_t<sizeof...(Is), F> (*)(F &);
+  constexpr Entry table[] = {&invoke_with_index<Is, F>...};
+  if (index >= sizeof...(Is)) {
+    bad_variant_access();
+  }
+  return table[index](f);
+}
+
+/**
+ * @brief Turns a runtime index below N into a compile-time one, using a
+ *        `switch` up to `switch_dispatch_limit` and a table above it.
+ */
+template <std::size_t N, typename F>
+constexpr with_index_result_t<N, F> with_index(std::size_t index, F &&f) {
+  if constexpr (N <= switch_dispatch_limit) {
+    return switch_with_index<N>(index, std::forward<F>(f));
+  } else {
+    return table_with_index(index, f, std::make_index_sequence<N>{});
+  }
+}
+
+/**
+ * @brief Dispatches the visitor with a `switch` on `variant.index()`, so
+ *        every handler can be inlined into its own case instead of being
+ *        called through the function-pointer table of `std::visit`.
+ */
+template <typename Visitor, typename Variant>
+constexpr visit_result_t<Visitor, Variant> switch_visit(Visitor &&visitor,
+                                                        Variant &&variant) {
+  constexpr std::size_t N = std::variant_size_v<remove_cvref_t<Variant>>;
+  static_assert(same_visit_results<Visitor, Variant>(
+                    std::make_index_sequence<N>{}),
+                "❌ INSPECT ERROR: the handlers return different types; "
+                "make them agree or give the type as Inspect<R>!");
+  return switch_with_index<N>(
+      variant.index(),
+      [&](auto index) -> visit_result_t<Visitor, Variant> {
+        return std::forward<Visitor>(visitor)(
+            get_alternative<decltype(index)::value>(
+                std::forward<Variant>(variant)));
+      });
+}
+
+/**
+ * @brief Visits the variant with a `switch` for small variants, falling back
+ *        to `std::visit` above `switch_dispatch_limit` alternatives.
+ */
+template <typename Visitor, typename Variant>
+constexpr decltype(auto) visit(Visitor &&visitor, Variant &&variant) {
+  constexpr std::size_t N = std::variant_size_v<remove_cvref_t<Variant>>;
+  if constexpr (N <= switch_dispatch_limit) {
+    return switch_visit(std::forward<Visitor>(visitor),
+                        std::forward<Variant>(variant));
+  } else {
+    // Tested here, so std::visit never reaches its own throw
+    if (variant.valueless_by_exception()) {
+      bad_variant_access();
+    }
+    return std::visit(std::forward<Visitor>(visitor),
+                      std::forward<Variant>(variant));
+  }
+}
+
+/**
+ * @brief Flattens the alternative indices of several variants into a single
+ *        mixed-radix index `((i1 * N2) + i2) * N3 + i3...`, and back.
+ */
+template <typename... Variants> struct combination {
+  static constexpr std::size_t count = (std::variant_size_v<Variants> * ...);
+
+  template <std::size_t K>
+  static constexpr std::size_t index(std::size_t flat) noexcept {
+    constexpr std::size_t sizes[] = {std::variant_size_v<Variants>...};
+    std::size_t stride = 1;
+    for (std::size_t k = K + 1; k < sizeof...(Variants); ++k) {
+      stride *= sizes[k];
+    }
+    return flat / stride % sizes[K];
+  }
+
+  static constexpr std::size_t flatten(const Variants &...variants) noexcept {
+    std::size_t flat = 0;
+    ((flat = flat * std::variant_size_v<Variants> + variants.index()), ...);
+    return flat;
+  }
+};
+
+template <std::size_t Flat, typename Visitor, typename Ks,
+          typename... Variants>
+struct combination_result;
+
+template <std::size_t Flat, typename Visitor, std::size_t... Ks,
+          typename... Variants>
+struct combination_result<Flat, Visitor, std::index_sequence<Ks...>,
+                          Variants...> {
+  using Combination = combination<remove_cvref_t<Variants>...>;
+  using type = std::invoke_result_t<
+      Visitor,
+      copy_cvref_t<Variants &&,
+                   std::variant_alternative_t<
+                       Combination::template index<Ks>(Flat),
+                       remove_cvref_t<Variants>>>...>;
+};
+
+/**
+ * @brief The result of the visitor for the combination of alternatives with
+ *        flattened index Flat.
+ */
+template <std::size_t Flat, typename Visitor, typename... Variants>
+using combination_result_t =
+    typename combination_result<Flat, Visitor,
+                                std::index_sequence_for<Variants...>,
+                                Variants...>::type;
+
+/**
+ * @brief The result of visiting the variants, taken from their first
+ *        combination; multi_visit checks that every other one agrees.
+ */
+template <typename Visitor, typename... Variants>
+using multi_visit_result_t = combination_result_t<0, Visitor, Variants...>;
+
+template <typename Visitor, typename... Variants, std::size_t... Flats>
+constexpr bool same_multi_visit_results(std::index_sequence<Flats...>) {
+  return (std::is_same_v<combination_result_t<Flats, Visitor, Variants...>,
+                         multi_visit_result_t<Visitor, Variants...>> &&
+          ...);
+}
+
+template <std::size_t Flat, typename Visitor, typename... Variants,
+          std::size_t... Ks>
+constexpr multi_visit_result_t<Visitor, Variants...>
+invoke_combination(std::index_sequence<Ks...>, Visitor &&visitor,
+                   Variants &&...variants) {
+  using Combination = combination<remove_cvref_t<Variants>...>;
+  return std::forward<Visitor>(visitor)(
+      get_alternative<Combination::template index<Ks>(Flat)>(
+          std::forward<Variants>(variants))...);
+}
+
+/**
+ * @brief Visits the variants one after another, binding the alternative of
+ *        the first one before dispatching on the next.
+ */
+template <typename R, typename Visitor, typename Variant, typename... Rest>
+constexpr R nested_visit(Visitor &&visitor, Variant &&variant,
+                         Rest &&...rest) {
+  return detail::visit(
+      [&](auto &&alternative) -> R {
+        auto bound = [&](auto &&...others) -> R {
+          return std::forward<Visitor>(visitor)(
+              std::forward<decltype(alternative)>(alternative),
+              std::forward<decltype(others)>(others)...);
+        };
+        if constexpr (sizeof...(Rest) == 0) {
+          return bound();
+        } else {
+          return nested_visit<R>(bound, std::forward<Rest>(rest)...);
+        }
+      },
+      std::forward<Variant>(variant));
+}
+
+/**
+ * @brief Visits several variants at once with a single `switch` on their
+ *        flattened index, instead of one nested dispatch per variant.
+ *
+ * @details Above `switch_dispatch_limit` combinations a single dispatch would
+ *          need a function-pointer table, which cannot inline the handlers
+ *          and measures slower than a `switch` per variant, so the variants
+ *          are then dispatched one by one.
+ *
+ * @throws std::bad_variant_access when any variant is valueless_by_exception,
+ *         or calls the panic handler without exceptions.
+ */
+template <typename Visitor, typename... Variants>
+constexpr multi_visit_result_t<Visitor, Variants...>
+multi_visit(Visitor &&visitor, Variants &&...variants) {
+  using R = multi_visit_result_t<Visitor, Variants...>;
+  using Combination = combination<remove_cvref_t<Variants>...>;
+  static_assert(same_multi_visit_results<Visitor, Variants...>(
+                    std::make_index_sequence<Combination::count>{}),
+                "❌ INSPECT ERROR: the handlers return different types; "
+                "make them agree or give the type as Inspect<R>!");
+
+  if constexpr (Combination::count <= switch_dispatch_limit) {
+    if ((variants.valueless_by_exception() || ...)) {
+      bad_variant_access();
+    }
+    return switch_with_index<Combination::count>(
+        Combination::flatten(variants...), [&](auto flat) -> R {
+          return invoke_combination<decltype(flat)::value>(
+              std::index_sequence_for<Variants...>{},
+              std::forward<Visitor>(visitor),
+              std::forward<Variants>(variants)...);
+        });
+  } else {
+    return nested_visit<R>(std::forward<Visitor>(visitor),
+                           std::forward<Variants>(variants)...);
+  }
+}
+
+/**
+ * @brief Wraps a visitor so that every handler result is turned into R
+ *        directly in the return slot of the call, for Inspect<R>.
+ *
+ * @details A handler already returning R is passed through as a prvalue
+ *          (guaranteed copy elision). Other results must convert to R
+ *          implicitly and are copy-initialized from, so no explicit
+ *          constructor or narrowing cast is applied behind the caller's
+ *          back. For Inspect<void> the results are discarded.
+ */
+template <typename R, typename Visitor> struct returning {
+  Visitor &visitor;
+
+  template <typename... Args> constexpr R operator()(Args &&...args) const {
+    using Handled = std::invoke_result_t<Visitor &, Args...>;
+    if constexpr (std::is_void_v<R>) {
+      static_cast<void>(visitor(std::forward<Args>(args)...));
+    } else {
+      static_assert(std::is_convertible_v<Handled, R>,
+                    "❌ INSPECT ERROR: a handler returns a type that does not "
+                    "implicitly convert to R of Inspect<R>; convert it in the "
+                    "handler!");
+      return visitor(std::forward<Args>(args)...);
+    }
+  }
+};
+
+template <typename T, typename = void>
+struct has_unchecked_access : std::false_type {};
+
+template <typename T>
+struct has_unchecked_access<
+    T, std::void_t<decltype(std::declval<T>().unsafe_value()),
+                   decltype(std::declval<T>().unsafe_error())>>
+    : std::true_type {};
+
+/**
+ * @brief Accesses the value of an Expected/Result whose state was already
+ *        tested, using the unchecked accessor when the type provides one.
+ */
+template <typename Exp> constexpr decltype(auto) expected_value(Exp &&exp) {
+  if constexpr (has_unchecked_access<Exp>::value) {
+    return std::forward<Exp>(exp).unsafe_value();
+  } else {
+    return std::forward<Exp>(exp).value();
+  }
+}
+
+/**
+ * @brief Accesses the error of an Expected/Result whose state was already
+ *        tested, using the unchecked accessor when the type provides one.
+ */
+template <typename Exp> constexpr decltype(auto) expected_error(Exp &&exp) {
+  if constexpr (has_unchecked_access<Exp>::value) {
+    return std::forward<Exp>(exp).unsafe_error();
+  } else {
+    return std::forward<Exp>(exp).error();
+  }
+}
+
+template <typename Exp>
+using expected_value_t = decltype(expected_value(std::declval<Exp>()));
+
+/**
+ * @brief Calls the success handler of an Expected/Result that holds a value:
+ *        with the value, or with no argument when the value type is void.
+ */
+template <typename Visitor, typename Exp>
+constexpr decltype(auto) invoke_value(Visitor &&visitor, Exp &&exp) {
+  if constexpr (std::is_void_v<expected_value_t<Exp>>) {
+    return std::forward<Visitor>(visitor)();
+  } else {
+    return std::forward<Visitor>(visitor)(
+        expected_value(std::forward<Exp>(exp)));
+  }
+}
+
+/**
+ * @brief A handler guarded by a run-time test: `fn` handles the arguments
+ *        it accepts when `test` holds for them. Built by when, eq and range.
+ */
+template <typename Test, typename F> struct pattern {
+  Test test;
+  F fn;
+};
+
+template <typename T> struct is_pattern : std::false_type {};
+template <typename Test, typename F>
+struct is_pattern<pattern<Test, F>> : std::true_type {};
+
+template <typename... Lambdas>
+inline constexpr bool has_patterns_v =
+    (is_pattern<remove_cvref_t<Lambdas>>::value || ...);
+
+/**
+ * @brief The test of eq: `arg == value`, for the arguments comparable with
+ *        the value only.
+ */
+template <typename V> struct equal_to_test {
+  V value;
+
+  template <typename Arg, typename = decltype(std::declval<const Arg &>() ==
+                                              std::declval<const V &>())>
+  constexpr bool operator()(const Arg &arg) const
+      noexcept(noexcept(std::declval<const Arg &>() ==
+                        std::declval<const V &>())) {
+    return arg == value;
+  }
+};
+
+/**
+ * @brief The test of range: `lo <= arg && arg <= hi`, for the arguments
+ *        ordered with both bounds only.
+ */
+template <typename Lo, typename Hi> struct between_test {
+  Lo lo;
+  Hi hi;
+
+  template <typename Arg,
+            typename = decltype(std::declval<const Lo &>() <=
+                                    std::declval<const Arg &>() &&
+                                std::declval<const Arg &>() <=
+                                    std::declval<const Hi &>())>
+  constexpr bool operator()(const Arg &arg) const
+      noexcept(noexcept(std::declval<const Lo &>() <=
+                            std::declval<const Arg &>() &&
+                        std::declval<const Arg &>() <=
+                            std::declval<const Hi &>())) {
+    return lo <= arg && arg <= hi;
+  }
+};
+
+/**
+ * @brief The handler of a pattern, const when the pattern is.
+ */
+template <typename Pattern>
+using pattern_handler_t = decltype((std::declval<Pattern &>().fn));
+
+template <typename Pattern>
+using pattern_test_t = decltype(std::remove_cv_t<Pattern>::test);
+
+/**
+ * @brief Whether a pattern takes part in the dispatch of these arguments:
+ *        both its test and its handler must accept them. Decided at compile
+ *        time, so a case only tests the patterns written for its types.
+ */
+template <typename Pattern, typename... Args>
+struct pattern_applies
+    : std::bool_constant<std::is_invocable_r_v<bool,
+                                               const pattern_test_t<Pattern> &,
+                                               const Args &...> &&
+                         std::is_invocable_v<pattern_handler_t<Pattern>,
+                                             Args...>> {};
+
+template <typename Pattern, typename R, typename... Args>
+constexpr bool nothrow_pattern() {
+  if constexpr (!pattern_applies<Pattern, Args...>::value) {
+    return true; // Never called for these arguments
+  } else {
+    using Handler = pattern_handler_t<Pattern>;
+    using Handled = std::invoke_result_t<Handler, Args...>;
+    return std::is_nothrow_invocable_r_v<bool,
+                                         const pattern_test_t<Pattern> &,
+                                         const Args &...> &&
+           std::is_nothrow_invocable_v<Handler, Args...> &&
+           (std::is_void_v<R> || std::is_nothrow_constructible_v<R, Handled>);
+  }
+}
+
+/**
+ * @brief The visitor of Inspect when some handlers are patterns. The type
+ *        switch of Inspect picks the case, then the case runs the tests of
+ *        the patterns that apply to its types, in the order they were given,
+ *        and falls back to the plain handlers, which must cover every case.
+ *
+ * @details The patterns that cannot take the arguments of a case are dropped
+ *          from it at compile time, so each case is a flat chain of value
+ *          tests with no type test left in it, the same code as a type switch
+ *          followed by a hand-written if/else ladder. The tests keep their
+ *          order, as overlapping guards rely on it (first match wins).
+ */
+template <typename Patterns, typename Fallback> struct guarded_visitor;
+
+template <typename... Patterns, typename Fallback>
+struct guarded_visitor<std::tuple<Patterns...>, Fallback> {
+  std::tuple<Patterns...> patterns;
+  Fallback fallback;
+
+  template <typename Self, typename... Args>
+  using result_t =
+      std::invoke_result_t<decltype((std::declval<Self &>().fallback)),
+                           Args...>;
+
+  template <typename Self, typename... Args>
+  static constexpr bool nothrow_match() {
+    using Qualified = decltype((std::declval<Self &>().fallback));
+    using R = result_t<Self, Args...>;
+    return std::is_nothrow_invocable_v<Qualified, Args...> &&
+           (nothrow_pattern<copy_const_t<Self, Patterns>, R, Args...>() &&
+            ...);
+  }
+
+  template <typename... Args,
+            std::enable_if_t<std::is_invocable_v<Fallback &, Args...>, int> =
+                0>
+  constexpr result_t<guarded_visitor, Args...> operator()(
+      Args &&...args) noexcept(nothrow_match<guarded_visitor, Args...>()) {
+    return match<0>(*this, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args,
+            std::enable_if_t<std::is_invocable_v<const Fallback &, Args...>,
+                             int> = 0>
+  constexpr result_t<const guarded_visitor, Args...>
+  operator()(Args &&...args) const
+      noexcept(nothrow_match<const guarded_visitor, Args...>()) {
+    return match<0>(*this, std::forward<Args>(args)...);
+  }
+
+private:
+  template <typename Self, typename T>
+  using copy_const_t = std::conditional_t<std::is_const_v<Self>, const T, T>;
+
+  template <std::size_t I, typename Self, typename... Args>
+  static constexpr result_t<Self, Args...> match(Self &self, Args &&...args) {
+    if constexpr (I == sizeof...(Patterns)) {
+      return self.fallback(std::forward<Args>(args)...);
+    } else {
+      using Pattern =
+          copy_const_t<Self, std::tuple_element_t<I, std::tuple<Patterns...>>>;
+      if constexpr (pattern_applies<Pattern, Args...>::value) {
+        using R = result_t<Self, Args...>;
+        using Handled =
+            std::invoke_result_t<pattern_handler_t<Pattern>, Args...>;
+        static_assert(std::is_void_v<R> || std::is_convertible_v<Handled, R>,
+                      "❌ INSPECT ERROR: a pattern must return a type "
+                      "convertible to the result of the plain handler of the "
+                      "same case!");
+
+        auto &guarded = std::get<I>(self.patterns);
+        if (guarded.test(std::as_const(args)...)) {
+          if constexpr (std::is_void_v<R>) {
+            guarded.fn(std::forward<Args>(args)...);
+            return;
+          } else {
+            return guarded.fn(std::forward<Args>(args)...);
+          }
+        }
+      }
+      return match<I + 1>(self, std::forward<Args>(args)...);
+    }
+  }
+};
+
+template <typename Lambda> constexpr auto select_patterns(Lambda &&lambda) {
+  if constexpr (is_pattern<remove_cvref_t<Lambda>>::value) {
+    return std::tuple<remove_cvref_t<Lambda>>(std::forward<Lambda>(lambda));
+  } else {
+    return std::tuple<>();
+  }
+}
+
+template <typename Lambda> constexpr auto select_handlers(Lambda &&lambda) {
+  if constexpr (is_pattern<remove_cvref_t<Lambda>>::value) {
+    return std::tuple<>();
+  } else {
+    return std::tuple<remove_cvref_t<Lambda>>(std::forward<Lambda>(lambda));
+  }
+}
+
+/**
+ * @brief Builds the visitor of Inspect from its handlers: an overloaded set
+ *        of them, or a guarded_visitor when some handlers are patterns.
+ */
+template <typename... Lambdas>
+constexpr auto make_visitor(Lambdas &&...lambdas) {
+  if constexpr (!has_patterns_v<Lambdas...>) {
+    return overloaded<remove_cvref_t<Lambdas>...>{
+        std::forward<Lambdas>(lambdas)...};
+  } else {
+    auto handlers =
+        std::tuple_cat(select_handlers(std::forward<Lambdas>(lambdas))...);
+    auto fallback = std::apply(
+        [](auto &&...each) {
+          return overloaded<remove_cvref_t<decltype(each)>...>{
+              std::forward<decltype(each)>(each)...};
+        },
+        std::move(handlers));
+    auto patterns =
+        std::tuple_cat(select_patterns(std::forward<Lambdas>(lambdas))...);
+    return guarded_visitor<decltype(patterns), decltype(fallback)>{
+        std::move(patterns), std::move(fallback)};
+  }
+}
+
+template <typename... Lambdas>
+using visitor_t = decltype(make_visitor(std::declval<Lambdas>()...));
+
 } // namespace detail
 
+/**
+ * @brief A handler taken only when `predicate(args...)` holds, for the
+ *        arguments both `predicate` and `handler` accept. Otherwise the next
+ *        handlers are tried, ending with the plain ones.
+ *
+ * @note Give the predicate a typed parameter, so it is only tried on the
+ *       alternatives it is meant for:
+ * ```cpp
+ * auto label = adt::Inspect(
+ *     reading, adt::when([](int v) { return v < 0; }, [](int) { return "-"; }),
+ *     [](int) { return "+"; }, [](const std::string &) { return "text"; });
+ * ```
+ */
+template <typename Predicate, typename Handler>
+[[nodiscard]] constexpr detail::pattern<detail::remove_cvref_t<Predicate>,
+                                        detail::remove_cvref_t<Handler>>
+when(Predicate &&predicate, Handler &&handler) {
+  return {std::forward<Predicate>(predicate), std::forward<Handler>(handler)};
+}
+
+/**
+ * @brief A handler taken when the argument compares equal to `value`, for the
+ *        alternatives comparable with it.
+ */
+template <typename V, typename Handler>
+[[nodiscard]] constexpr detail::pattern<detail::equal_to_test<std::decay_t<V>>,
+                                        detail::remove_cvref_t<Handler>>
+eq(V &&value, Handler &&handler) {
+  return {{std::forward<V>(value)}, std::forward<Handler>(handler)};
+}
+
+/**
+ * @brief A handler taken when `lo <= argument <= hi` (both bounds included),
+ *        for the alternatives ordered with the bounds.
+ */
+template <typename Lo, typename Hi, typename Handler>
+[[nodiscard]] constexpr detail::pattern<
+    detail::between_test<std::decay_t<Lo>, std::decay_t<Hi>>,
+    detail::remove_cvref_t<Handler>>
+range(Lo &&lo, Hi &&hi, Handler &&handler) {
+  return {{std::forward<Lo>(lo), std::forward<Hi>(hi)},
+          std::forward<Handler>(handler)};
+}
+
 namespace diagnostic {
 
 template <typename T> struct always_false : std::false_type {};
@@ -45,9 +812,15 @@ template <typename T> struct MISSING_HANDLER_FOR_TYPE {
   static constexpr bool value = false;
 };
 
-template <typename Visitor, typename Variant> struct variant_validator;
+template <typename T> struct MISSING_HANDLER_FOR_COMBINATION {
+  static constexpr bool value = false;
+};
+
+template <typename Visitor, typename Variant, typename... Rest>
+struct variant_validator;
 
-template <typename Visitor, typename Variant> struct variant_validator {
+template <typename Visitor, typename Variant>
+struct variant_validator<Visitor, Variant> {
 
   using CleanVariant = std::remove_reference_t<Variant>;
 
@@ -67,7 +840,55 @@ template <typename Visitor, typename Variant> struct variant_validator {
   }
 
   static constexpr void validate() {
+#if ADT_INSPECT_FAST_COMPILE
+    if constexpr (!detail::all_alternatives<
+                      detail::invocable_by<Visitor>::template check,
+                      Variant>::value) {
+      validate_all(
+          std::make_index_sequence<std::variant_size_v<CleanVariant>>{});
+    }
+#else
     validate_all(std::make_index_sequence<std::variant_size_v<CleanVariant>>{});
+#endif
+  }
+};
+
+/**
+ * @brief Validator of a multi-variant Inspect: every combination of
+ *        alternatives, one from each variant, must have a handler.
+ */
+template <typename Visitor, typename Variant, typename... Rest>
+struct variant_validator {
+  using Combination =
+      detail::combination<detail::remove_cvref_t<Variant>,
+                          detail::remove_cvref_t<Rest>...>;
+
+  template <std::size_t Flat, std::size_t... Ks>
+  static constexpr void validate_combination(std::index_sequence<Ks...>) {
+    using Args = std::tuple<Variant, Rest...>;
+
+    if constexpr (!std::is_invocable_v<
+                      Visitor,
+                      decltype(std::get<Combination::template index<Ks>(Flat)>(
+                          std::declval<std::tuple_element_t<Ks, Args>>()))...>) {
+      static_assert(
+          MISSING_HANDLER_FOR_COMBINATION<std::tuple<std::decay_t<decltype(
+              std::get<Combination::template index<Ks>(Flat)>(
+                  std::declval<std::tuple_element_t<Ks, Args>>()))>...>>::value,
+          "❌ INSPECT ERROR: you did not provide a handler for the combination "
+          "of types ->");
+    }
+  }
+
+  template <std::size_t... Flats>
+  static constexpr void validate_all(std::index_sequence<Flats...>) {
+    (validate_combination<Flats>(
+         std::make_index_sequence<1 + sizeof...(Rest)>{}),
+     ...);
+  }
+
+  static constexpr void validate() {
+    validate_all(std::make_index_sequence<Combination::count>{});
   }
 };
 
@@ -111,13 +932,24 @@ template <typename Visitor, typename Exp> struct expected_validator {
     using ErrT =
         typename detail::remove_cvref_t<decltype(std::declval<Exp>().error())>;
 
-    constexpr bool handles_value = std::is_invocable_v<Visitor, ValT>;
-    if constexpr (!handles_value) {
-      static_assert(always_false<ValT>::value,
-                    "❌ ALGEBRAIC ERROR: Inspect for Result does not handle the "
-                    "success type!");
-      static_assert(MISSING_HANDLER_FOR_TYPE<ValT>::value,
-                    "Missing handler for value ->");
+    if constexpr (std::is_void_v<ValT>) {
+      constexpr bool handles_value = std::is_invocable_v<Visitor>;
+      if constexpr (!handles_value) {
+        static_assert(always_false<Exp>::value,
+                      "❌ ALGEBRAIC ERROR: Inspect for Result<void, E> does "
+                      "not handle the success state!");
+        static_assert(MISSING_HANDLER_FOR_NONE<Exp>::value,
+                      "You need to provide no-argument lambda: []() { ... }");
+      }
+    } else {
+      constexpr bool handles_value = std::is_invocable_v<Visitor, ValT>;
+      if constexpr (!handles_value) {
+        static_assert(always_false<ValT>::value,
+                      "❌ ALGEBRAIC ERROR: Inspect for Result does not handle "
+                      "the success type!");
+        static_assert(MISSING_HANDLER_FOR_TYPE<ValT>::value,
+                      "Missing handler for value ->");
+      }
     }
 
     constexpr bool handles_error = std::is_invocable_v<Visitor, ErrT>;
@@ -143,10 +975,22 @@ struct is_variant_impl<std::variant<Args...>> : std::true_type {};
 template <typename T>
 struct is_variant : is_variant_impl<detail::remove_cvref_t<T>> {};
 
-// --- Detector of std::optional ---
+// --- Number of variants at the front of an argument list ---
+template <typename... Ts>
+struct leading_variants : std::integral_constant<std::size_t, 0> {};
+template <typename T, typename... Ts>
+struct leading_variants<T, Ts...>
+    : std::integral_constant<std::size_t,
+                             is_variant<T>::value
+                                 ? 1 + leading_variants<Ts...>::value
+                                 : 0> {};
+
+// --- Detector of std::optional and adt::Optional ---
 template <typename T> struct is_optional_impl : std::false_type {};
 template <typename T>
 struct is_optional_impl<std::optional<T>> : std::true_type {};
+template <typename T>
+struct is_optional_impl<Optional<T>> : std::true_type {};
 
 template <typename T>
 struct is_optional : is_optional_impl<detail::remove_cvref_t<T>> {};
@@ -170,6 +1014,323 @@ struct is_expected
 
 } // namespace traits
 
+#if ADT_INSPECT_CONCEPTS
+/**
+ * @brief The kinds of types accepted by Inspect: std::variant, an optional
+ *        (std::optional or adt::Optional) and an Expected/Result, i.e. any
+ *        other type with has_value(), value() and error().
+ */
+template <typename T>
+concept variant_like = traits::is_variant<T>::value;
+
+template <typename T>
+concept optional_like = traits::is_optional<T>::value;
+
+template <typename T>
+concept expected_like =
+    !optional_like<T> && requires(detail::remove_cvref_t<T> exp) {
+      exp.has_value();
+      std::move(exp).value();
+      std::move(exp).error();
+    };
+#endif
+
+namespace detail {
+
+/**
+ * @brief Runs the validator matching the kind of Adt: variant, optional or
+ *        Expected/Result.
+ */
+template <typename Visitor, typename Adt>
+constexpr void validate_inspectable() {
+  if constexpr (traits::is_variant<Adt>::value) {
+    diagnostic::variant_validator<Visitor, Adt>::validate();
+  } else if constexpr (traits::is_optional<Adt>::value) {
+    diagnostic::optional_validator<Visitor, Adt>::validate();
+  } else if constexpr (traits::is_expected<Adt>::value) {
+    diagnostic::expected_validator<Visitor, Adt>::validate();
+  } else {
+    static_assert(diagnostic::always_false<Adt>::value,
+                  "❌ INSPECT ERROR: expected a std::variant, an optional or "
+                  "an Expected/Result!");
+  }
+}
+
+/**
+ * @brief Applies an already built (and validated) visitor to any inspectable
+ *        type, the way Inspect does. Used by the range forms, which build the
+ *        visitor once for all elements.
+ */
+template <typename Visitor, typename Adt>
+constexpr auto inspect_with(Visitor &&visitor, Adt &&value) {
+  if constexpr (traits::is_variant<Adt>::value) {
+    return detail::visit(std::forward<Visitor>(visitor),
+                         std::forward<Adt>(value));
+  } else if constexpr (traits::is_optional<Adt>::value) {
+    if (value) {
+      return std::forward<Visitor>(visitor)(*std::forward<Adt>(value));
+    }
+    return std::forward<Visitor>(visitor)();
+  } else {
+    if (value.has_value()) {
+      return invoke_value(std::forward<Visitor>(visitor),
+                          std::forward<Adt>(value));
+    }
+    return std::forward<Visitor>(visitor)(
+        expected_error(std::forward<Adt>(value)));
+  }
+}
+
+/**
+ * @brief inspect_with for an optional or an Expected/Result whose empty or
+ *        error case is rare: that branch is marked unlikely and its handler
+ *        runs from a cold, out-of-line frame.
+ */
+template <typename Visitor, typename Adt>
+constexpr auto inspect_likely_with(Visitor &&visitor, Adt &&value) {
+  if constexpr (traits::is_optional<Adt>::value) {
+    if (ADT_LIKELY(static_cast<bool>(value))) {
+      return visitor(*std::forward<Adt>(value));
+    }
+    return cold_invoke([&] { return visitor(); });
+  } else {
+    if (ADT_LIKELY(value.has_value())) {
+      return invoke_value(visitor, std::forward<Adt>(value));
+    }
+    return cold_invoke(
+        [&] { return visitor(expected_error(std::forward<Adt>(value))); });
+  }
+}
+
+/**
+ * @brief Whether invoking the visitor with Args, and turning its result into
+ *        R for Inspect<R>, cannot throw.
+ */
+template <typename R, typename Visitor, typename... Args>
+constexpr bool nothrow_handler() {
+  if constexpr (!std::is_invocable_v<Visitor &, Args...>) {
+    return false; // Reported by the validators
+  } else {
+    using Handled = std::invoke_result_t<Visitor &, Args...>;
+    constexpr bool nothrow_call =
+        std::is_nothrow_invocable_v<Visitor &, Args...>;
+    if constexpr (std::is_same_v<R, deduce_return_type> ||
+                  std::is_same_v<R, Handled>) {
+      return nothrow_call;
+    } else {
+      return nothrow_call && std::is_nothrow_constructible_v<R, Handled>;
+    }
+  }
+}
+
+template <typename R, typename Visitor, typename Exp>
+constexpr bool nothrow_value_handler() {
+  if constexpr (std::is_void_v<expected_value_t<Exp>>) {
+    return nothrow_handler<R, Visitor>();
+  } else {
+    return nothrow_handler<R, Visitor, expected_value_t<Exp>>();
+  }
+}
+
+template <typename R, typename Visitor, std::size_t Flat, typename Variants,
+          std::size_t... Ks>
+constexpr bool nothrow_combination(std::index_sequence<Ks...>) {
+  using Combination =
+      combination<remove_cvref_t<std::tuple_element_t<Ks, Variants>>...>;
+  return nothrow_handler<
+      R, Visitor,
+      decltype(std::get<Combination::template index<Ks>(Flat)>(
+          std::declval<std::tuple_element_t<Ks, Variants>>()))...>();
+}
+
+template <typename R, typename Visitor, typename Variants,
+          std::size_t... Flats>
+constexpr bool nothrow_combinations(std::index_sequence<Flats...>) {
+  return (nothrow_combination<R, Visitor, Flats, Variants>(
+              std::make_index_sequence<std::tuple_size_v<Variants>>{}) &&
+          ...);
+}
+
+template <typename R, typename Visitor> struct nothrow_handler_of {
+  template <typename Arg>
+  using check = std::bool_constant<nothrow_handler<R, Visitor, Arg>()>;
+};
+
+template <typename R, typename Visitor, typename... Adts>
+constexpr bool nothrow_cases() {
+  if constexpr (sizeof...(Adts) == 1 &&
+                (traits::is_variant<Adts>::value && ...)) {
+    return (all_alternatives<nothrow_handler_of<R, Visitor>::template check,
+                             Adts>::value &&
+            ...);
+  } else if constexpr ((traits::is_variant<Adts>::value && ...)) {
+    return nothrow_combinations<R, Visitor, std::tuple<Adts...>>(
+        std::make_index_sequence<
+            combination<remove_cvref_t<Adts>...>::count>{});
+  } else if constexpr ((traits::is_optional<Adts>::value && ...)) {
+    return (nothrow_handler<R, Visitor, decltype(*std::declval<Adts>())>() &&
+            ...) &&
+           nothrow_handler<R, Visitor>();
+  } else {
+    return (nothrow_value_handler<R, Visitor, Adts>() && ...) &&
+           (nothrow_handler<R, Visitor,
+                            decltype(expected_error(std::declval<Adts>()))>() &&
+            ...);
+  }
+}
+
+/**
+ * @brief Whether testing the state of an Adt, and reaching the value or
+ *        error handed to the handlers, cannot throw. Only a variant is known
+ *        to be safe; a lazy Result, for one, is evaluated by has_value().
+ */
+template <typename Adt> constexpr bool nothrow_state() {
+  if constexpr (traits::is_variant<Adt>::value) {
+    return true;
+  } else if constexpr (traits::is_optional<Adt>::value) {
+    return noexcept(static_cast<bool>(std::declval<Adt>())) &&
+           noexcept(std::declval<Adt>().has_value()) &&
+           noexcept(*std::declval<Adt>());
+  } else if constexpr (has_unchecked_access<Adt>::value) {
+    return noexcept(std::declval<Adt>().has_value()) &&
+           noexcept(std::declval<Adt>().unsafe_value()) &&
+           noexcept(std::declval<Adt>().unsafe_error());
+  } else {
+    return noexcept(std::declval<Adt>().has_value());
+  }
+}
+
+/**
+ * @brief Whether Inspect<R> over the Adts (a std::tuple of them) with these
+ *        lambdas cannot throw: building the visitor, testing and accessing
+ *        every Adt, every handler that can be selected and the construction
+ *        of R must all be noexcept.
+ */
+template <typename R, typename Adts, typename... Lambdas, std::size_t... Is>
+constexpr bool nothrow_inspect(std::index_sequence<Is...>) {
+  using VisitorType = visitor_t<Lambdas...>;
+  return (std::is_nothrow_constructible_v<remove_cvref_t<Lambdas>,
+                                          Lambdas &&> &&
+          ...) &&
+         (nothrow_state<std::tuple_element_t<Is, Adts>>() && ...) &&
+         nothrow_cases<R, VisitorType, std::tuple_element_t<Is, Adts>...>();
+}
+
+template <typename R, typename Adts, typename... Lambdas>
+constexpr bool nothrow_inspect() {
+  return nothrow_inspect<R, Adts, Lambdas...>(
+      std::make_index_sequence<std::tuple_size_v<Adts>>{});
+}
+
+template <typename R, typename Args, std::size_t... Vs, std::size_t... Ls>
+constexpr bool nothrow_inspect_split(std::index_sequence<Vs...>,
+                                     std::index_sequence<Ls...>) {
+  return nothrow_inspect<
+      R, std::tuple<std::tuple_element_t<Vs, Args>...>,
+      std::tuple_element_t<sizeof...(Vs) + Ls, Args>...>();
+}
+
+} // namespace detail
+
+/**
+ * @brief Tells whether `Inspect(adt, lambdas...)` is noexcept for an Adt and
+ *        lambdas of these types, for static dispatch on the no-throw path.
+ *
+ * @note Usage:
+ * ```cpp
+ * if constexpr (adt::is_nothrow_inspectable_v<const Event &, OnA, OnB>) {
+ *   // commit in place
+ * } else {
+ *   // copy, then swap
+ * }
+ * ```
+ */
+template <typename Adt, typename... Lambdas>
+struct is_nothrow_inspectable
+    : std::bool_constant<detail::nothrow_inspect<
+          detail::deduce_return_type, std::tuple<Adt>, Lambdas...>()> {};
+
+template <typename Adt, typename... Lambdas>
+inline constexpr bool is_nothrow_inspectable_v =
+    is_nothrow_inspectable<Adt, Lambdas...>::value;
+
+/**
+ * @brief Hint naming the alternative of a std::variant that dominates at a
+ *        call site, given as the R of Inspect: `Inspect<adt::hot<B>>(v, ...)`
+ *        tests `index() == index of B` first and calls its handler directly,
+ *        a well-predicted branch, before falling back to the full dispatch.
+ *        The second parameter is the return type, deduced by default.
+ *
+ * @note The profile counters (ADT_INSPECT_PROFILE) tell which alternative
+ *       is worth the hint.
+ */
+template <typename Alternative, typename R = detail::deduce_return_type>
+struct hot {};
+
+namespace detail {
+
+template <typename R> struct hot_hint {
+  static constexpr bool enabled = false;
+  using return_type = R;
+};
+
+template <typename Alternative, typename R>
+struct hot_hint<hot<Alternative, R>> {
+  static constexpr bool enabled = true;
+  using alternative = Alternative;
+  using return_type = R;
+};
+
+/**
+ * @brief The return type requested from Inspect<R>, without the hot hint.
+ */
+template <typename R> using hinted_return_t = typename hot_hint<R>::return_type;
+
+/**
+ * @brief Index of Alternative in a std::variant holding it exactly once.
+ */
+template <typename Alternative, typename Variant> struct alternative_index;
+
+template <typename Alternative, typename... Ts>
+struct alternative_index<Alternative, std::variant<Ts...>> {
+  static_assert((std::is_same_v<Alternative, Ts> + ... + 0) == 1,
+                "❌ INSPECT ERROR: the alternative must appear exactly once "
+                "in the variant!");
+
+  static constexpr std::size_t find() noexcept {
+    constexpr bool matches[] = {std::is_same_v<Alternative, Ts>...};
+    std::size_t index = 0;
+    while (!matches[index]) {
+      ++index;
+    }
+    return index;
+  }
+
+  static constexpr std::size_t value = find();
+};
+
+/**
+ * @brief Dispatches with a test on the Hot-th alternative ahead of the
+ *        switch, for Inspect<adt::hot<...>>.
+ */
+template <typename R, std::size_t Hot, typename Visitor, typename Variant>
+constexpr auto inspect_hot(Visitor &visitor, Variant &&variant) {
+  if constexpr (std::is_same_v<R, deduce_return_type>) {
+    if (ADT_LIKELY(variant.index() == Hot)) {
+      return visitor(get_alternative<Hot>(std::forward<Variant>(variant)));
+    }
+    return detail::visit(visitor, std::forward<Variant>(variant));
+  } else {
+    returning<R, Visitor> convert{visitor};
+    if (ADT_LIKELY(variant.index() == Hot)) {
+      return convert(get_alternative<Hot>(std::forward<Variant>(variant)));
+    }
+    return detail::visit(convert, std::forward<Variant>(variant));
+  }
+}
+
+} // namespace detail
+
 /**
  * @brief Inspects a std::variant and applies the appropriate lambda based on
  * the active type.
@@ -177,7 +1338,7 @@ struct is_expected
  * @param R The return type. If not specified, it is deduced.
  * @param Variant The variant type to inspect.
  * @param lambdas The lambdas corresponding to each type in the variant.
- * @return The result of the invoked lambda, either wrapped in R or deduced.
+ * @return The result of the invoked lambda, either converted to R or deduced.
  *
  * @warning This function assumes that the number of lambdas provided matches
  *          all the types in the variant. If not, it will result in a
@@ -188,6 +1349,17 @@ struct is_expected
  *          number of types in the variant. It uses static_assert to enforce
  * this constraint.
  *
+ *          Variants with up to `detail::switch_dispatch_limit` alternatives are
+ *          dispatched with a `switch` on `index()`, larger ones use
+ *          `std::visit`.
+ *
+ *          Inspect is noexcept exactly when building the visitor, every
+ *          handler and the construction of R are, see
+ *          is_nothrow_inspectable. The handlers cannot see a valueless
+ *          variant, so it does not count: a noexcept Inspect of a variant
+ *          that is valueless_by_exception calls std::terminate instead of
+ *          throwing std::bad_variant_access (test_noexcept_valueless).
+ *
  * @note This function might be used as an expression or a statement, depending
  *       on whether the return type R is specified or deduced. Here is an
  *       example:
@@ -211,30 +1383,136 @@ struct is_expected
  * }
  * ```
  */
+#if ADT_INSPECT_CONCEPTS
+template <typename R = detail::deduce_return_type, variant_like Variant,
+          typename... Lambdas>
+  requires(!variant_like<Lambdas> && ...)
+#else
 template <typename R = detail::deduce_return_type,
           typename Variant, // Correct version
           typename... Lambdas,
-          // Condition 1: It is a variant
-          std::enable_if_t<traits::is_variant<Variant>::value, int> = 0>
+          // Condition 1: It is a variant, and the only one
+          std::enable_if_t<
+              traits::leading_variants<Variant, Lambdas...>::value == 1, int> =
+              0>
+#endif
 [[nodiscard]]
-constexpr auto Inspect(Variant &&variant, Lambdas &&...lambdas) {
+constexpr auto Inspect(Variant &&variant, Lambdas &&...lambdas) noexcept(
+    detail::nothrow_inspect<detail::hinted_return_t<R>, std::tuple<Variant &&>,
+                            Lambdas...>()) {
   // --- validation start
-  using VisitorType = overloaded<detail::remove_cvref_t<Lambdas>...>;
+  using VisitorType = detail::visitor_t<Lambdas...>;
   // using RawVariant = detail::remove_cvref_t<Variant>;
   using RawVariant = decltype(std::declval<Variant>());
   diagnostic::variant_validator<VisitorType, RawVariant>::validate();
   // --- validation end
 
+  ADT_INSPECT_COUNT(profile::site_kind::VARIANT,
+                    detail::remove_cvref_t<Variant>, VisitorType,
+                    std::variant_size_v<detail::remove_cvref_t<Variant>>,
+                    variant.index());
+
   // It is safe to proceed
-  if constexpr (std::is_same_v<R, detail::deduce_return_type>) {
-    return std::visit(overloaded{std::forward<Lambdas>(lambdas)...},
-                      std::forward<Variant>(variant));
+  if constexpr (detail::hot_hint<R>::enabled) {
+    constexpr std::size_t Hot = detail::alternative_index<
+        typename detail::hot_hint<R>::alternative,
+        detail::remove_cvref_t<Variant>>::value;
+    auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+    return detail::inspect_hot<detail::hinted_return_t<R>, Hot>(
+        visitor, std::forward<Variant>(variant));
+  } else if constexpr (std::is_same_v<R, detail::deduce_return_type>) {
+    return detail::visit(
+        detail::make_visitor(std::forward<Lambdas>(lambdas)...),
+        std::forward<Variant>(variant));
   } else {
-    return R{std::visit(overloaded{std::forward<Lambdas>(lambdas)...},
-                        std::forward<Variant>(variant))};
+    auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+    return detail::visit(detail::returning<R, VisitorType>{visitor},
+                         std::forward<Variant>(variant));
   }
 }
 
+namespace detail {
+
+template <typename R, typename... Variants, typename... Lambdas>
+constexpr auto inspect_variants(std::tuple<Variants...> variants,
+                                Lambdas &&...lambdas) {
+  using VisitorType = detail::visitor_t<Lambdas...>;
+  diagnostic::variant_validator<VisitorType, Variants...>::validate();
+
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  return std::apply(
+      [&](auto &&...each) {
+        if constexpr (std::is_same_v<R, detail::deduce_return_type>) {
+          return detail::multi_visit(visitor,
+                                     std::forward<decltype(each)>(each)...);
+        } else {
+          return detail::multi_visit(
+              detail::returning<R, VisitorType>{visitor},
+              std::forward<decltype(each)>(each)...);
+        }
+      },
+      std::move(variants));
+}
+
+template <typename R, typename Args, std::size_t... Vs, std::size_t... Ls>
+constexpr auto inspect_split(Args &&args, std::index_sequence<Vs...>,
+                             std::index_sequence<Ls...>) {
+  constexpr std::size_t V = sizeof...(Vs);
+  return inspect_variants<R>(
+      std::forward_as_tuple(std::get<Vs>(std::move(args))...),
+      std::get<V + Ls>(std::move(args))...);
+}
+
+} // namespace detail
+
+/**
+ * @brief Inspects several std::variants at once (a cartesian match) and
+ *        applies the lambda matching the combination of active types.
+ *
+ * @param R The return type. If not specified, it is deduced.
+ * @param args The variants, followed by the lambdas. A lambda taking one
+ *        parameter per variant must exist for every combination.
+ * @return The result of the invoked lambda, either converted to R or deduced.
+ *
+ * @details Up to `detail::switch_dispatch_limit` combinations, the
+ *          alternative indices are flattened into one index, `i1 * N2 + i2`
+ *          for two variants, and dispatched with a single `switch` whatever
+ *          the number of variants. Larger products use a `switch` per
+ *          variant.
+ *
+ * @note Matching a state and an event:
+ * ```cpp
+ * std::variant<Idle, Running> state = ...;
+ * std::variant<Start, Stop> event = ...;
+ *
+ * state = Inspect<decltype(state)>(
+ *     state, event,
+ *     [](Idle, Start) { return Running{}; },
+ *     [](Running, Stop) { return Idle{}; },
+ *     [](auto current, auto) { return current; });
+ * ```
+ */
+#if ADT_INSPECT_CONCEPTS
+template <typename R = detail::deduce_return_type, typename... Args>
+  requires(traits::leading_variants<Args...>::value >= 2)
+#else
+template <typename R = detail::deduce_return_type, typename... Args,
+          std::enable_if_t<(traits::leading_variants<Args...>::value >= 2),
+                           int> = 0>
+#endif
+[[nodiscard]]
+constexpr auto Inspect(Args &&...args) noexcept(
+    detail::nothrow_inspect_split<R, std::tuple<Args &&...>>(
+        std::make_index_sequence<traits::leading_variants<Args...>::value>{},
+        std::make_index_sequence<sizeof...(Args) -
+                                 traits::leading_variants<Args...>::value>{})) {
+  constexpr std::size_t V = traits::leading_variants<Args...>::value;
+  return detail::inspect_split<R>(
+      std::forward_as_tuple(std::forward<Args>(args)...),
+      std::make_index_sequence<V>{},
+      std::make_index_sequence<sizeof...(Args) - V>{});
+}
+
 /**
  * @brief Inspects a std::optional and applies the appropriate lambda based on
  * whether it contains a value or not.
@@ -242,7 +1520,7 @@ constexpr auto Inspect(Variant &&variant, Lambdas &&...lambdas) {
  * @param R The return type. If not specified, it is deduced.
  * @param Opt The optional type to inspect.
  * @param lambdas The lambdas for the value and no-value cases.
- * @return The result of the invoked lambda, either wrapped in R or deduced.
+ * @return The result of the invoked lambda, either converted to R or deduced.
  *
  * @warning This function assumes that at least one lambda is provided: one for
  * the value case and optionally one for the no-value case. If not, it will
@@ -270,32 +1548,46 @@ constexpr auto Inspect(Variant &&variant, Lambdas &&...lambdas) {
  * }
  * ```
  */
+#if ADT_INSPECT_CONCEPTS
+template <typename R = detail::deduce_return_type, optional_like Opt,
+          typename... Lambdas>
+#else
 template <typename R = detail::deduce_return_type, typename Opt,
           typename... Lambdas,
           std::enable_if_t<traits::is_optional<Opt>::value, int> = 0>
+#endif
 [[nodiscard]]
-constexpr auto Inspect(Opt &&opt, Lambdas &&...lambdas) noexcept {
+constexpr auto Inspect(Opt &&opt, Lambdas &&...lambdas) noexcept(
+    detail::nothrow_inspect<R, std::tuple<Opt &&>, Lambdas...>()) {
 
-  using VisitorType = overloaded<detail::remove_cvref_t<Lambdas>...>;
+  static_assert(!detail::hot_hint<R>::enabled,
+                "❌ INSPECT ERROR: adt::hot applies to std::variant; use "
+                "InspectLikely for optionals and Results!");
+  using VisitorType = detail::visitor_t<Lambdas...>;
 
   // using RawOpt = detail::remove_cvref_t<Opt>;
   using RawOpt = decltype(std::declval<Opt>());
   diagnostic::optional_validator<VisitorType, RawOpt>::validate();
 
-  auto visitor = VisitorType{std::forward<Lambdas>(lambdas)...};
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
 
   constexpr bool has_explicit_return_type =
       !std::is_same_v<R, detail::deduce_return_type>;
 
   if (opt) {
+    ADT_INSPECT_COUNT(profile::site_kind::OPTIONAL,
+                      detail::remove_cvref_t<Opt>, VisitorType, 2, 0);
     if constexpr (has_explicit_return_type) {
-      return R{visitor(*std::forward<Opt>(opt))};
+      return detail::returning<R, VisitorType>{visitor}(
+          *std::forward<Opt>(opt));
     } else {
       return visitor(*std::forward<Opt>(opt));
     }
   } else {
+    ADT_INSPECT_COUNT(profile::site_kind::OPTIONAL,
+                      detail::remove_cvref_t<Opt>, VisitorType, 2, 1);
     if constexpr (has_explicit_return_type) {
-      return R{visitor()};
+      return detail::returning<R, VisitorType>{visitor}();
     } else {
       return visitor();
     }
@@ -308,8 +1600,10 @@ constexpr auto Inspect(Opt &&opt, Lambdas &&...lambdas) noexcept {
  *
  * @param R The return type. If not specified, it is deduced.
  * @param Exp The Expected/Result type to inspect.
- * @param lambdas The lambdas for the value and error cases.
- * @return The result of the invoked lambda, either wrapped in R or deduced.
+ * @param lambdas The lambdas for the value and error cases. When the value
+ *        type is void, as in Result<void, E>, the success case is handled by
+ *        a no-argument lambda, like std::nullopt for optionals.
+ * @return The result of the invoked lambda, either converted to R or deduced.
  *
  * @warning This function assumes that at least one lambda is provided: one for
  * the value case and optionally ontemplate e for the error case. If not, it
@@ -340,35 +1634,98 @@ constexpr auto Inspect(Opt &&opt, Lambdas &&...lambdas) noexcept {
  * }
  * ```
  */
+#if ADT_INSPECT_CONCEPTS
+template <typename R = detail::deduce_return_type, expected_like Exp,
+          typename... Lambdas>
+#else
 template <typename R = detail::deduce_return_type, typename Exp,
           typename... Lambdas,
           // 1. Is it expected(type)?
           std::enable_if_t<traits::is_expected<Exp>::value, int> = 0>
+#endif
 [[nodiscard]]
-constexpr auto Inspect(Exp &&exp, Lambdas &&...lambdas) noexcept {
+constexpr auto Inspect(Exp &&exp, Lambdas &&...lambdas) noexcept(
+    detail::nothrow_inspect<R, std::tuple<Exp &&>, Lambdas...>()) {
 
   // --- validation start
-  using VisitorType = overloaded<detail::remove_cvref_t<Lambdas>...>;
+  static_assert(!detail::hot_hint<R>::enabled,
+                "❌ INSPECT ERROR: adt::hot applies to std::variant; use "
+                "InspectLikely for optionals and Results!");
+  using VisitorType = detail::visitor_t<Lambdas...>;
   diagnostic::expected_validator<VisitorType, Exp>::validate();
   // --- validation end
 
-  auto visitor = overloaded{std::forward<Lambdas>(lambdas)...};
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
   constexpr bool has_explicit_return_type =
       !std::is_same_v<R, detail::deduce_return_type>;
 
   if (exp.has_value()) {
+    ADT_INSPECT_COUNT(profile::site_kind::RESULT,
+                      detail::remove_cvref_t<Exp>, VisitorType, 2, 0);
     if constexpr (has_explicit_return_type) {
-      return R{visitor(std::forward<Exp>(exp).value())};
+      return detail::invoke_value(detail::returning<R, VisitorType>{visitor},
+                                  std::forward<Exp>(exp));
     } else {
-      return visitor(std::forward<Exp>(exp).value());
+      return detail::invoke_value(visitor, std::forward<Exp>(exp));
     }
   } else {
+    ADT_INSPECT_COUNT(profile::site_kind::RESULT,
+                      detail::remove_cvref_t<Exp>, VisitorType, 2, 1);
     if constexpr (has_explicit_return_type) {
-      return R{visitor(std::forward<Exp>(exp).error())};
+      return detail::returning<R, VisitorType>{visitor}(
+          detail::expected_error(std::forward<Exp>(exp)));
     } else {
-      return visitor(std::forward<Exp>(exp).error());
+      return visitor(detail::expected_error(std::forward<Exp>(exp)));
     }
   }
 }
 
-} // namespace adt
\ No newline at end of file
+/**
+ * @brief Inspect for an optional or an Expected/Result that almost always
+ *        holds a value. The empty or error branch is marked unlikely and its
+ *        handler is called from a cold, out-of-line function, so the hot
+ *        path stays compact in the instruction cache.
+ *
+ * @note Same handlers, coverage checks and return type rules as Inspect:
+ * ```cpp
+ * auto size = adt::InspectLikely(
+ *     lookup(key), [](const Entry &entry) { return entry.size; },
+ *     [](LookupError err) { return report(err); });
+ * ```
+ */
+#if ADT_INSPECT_CONCEPTS
+template <typename R = detail::deduce_return_type, typename Adt,
+          typename... Lambdas>
+  requires(optional_like<Adt> || expected_like<Adt>)
+#else
+template <typename R = detail::deduce_return_type, typename Adt,
+          typename... Lambdas,
+          std::enable_if_t<traits::is_optional<Adt>::value ||
+                               traits::is_expected<Adt>::value,
+                           int> = 0>
+#endif
+[[nodiscard]]
+constexpr auto InspectLikely(Adt &&adt, Lambdas &&...lambdas) noexcept(
+    detail::nothrow_inspect<R, std::tuple<Adt &&>, Lambdas...>()) {
+  static_assert(!detail::hot_hint<R>::enabled,
+                "❌ INSPECT ERROR: adt::hot applies to std::variant; "
+                "InspectLikely already favours the value!");
+  using VisitorType = detail::visitor_t<Lambdas...>;
+  detail::validate_inspectable<VisitorType, Adt>();
+
+  ADT_INSPECT_COUNT(traits::is_optional<Adt>::value
+                        ? profile::site_kind::OPTIONAL
+                        : profile::site_kind::RESULT,
+                    detail::remove_cvref_t<Adt>, VisitorType, 2,
+                    adt.has_value() ? 0 : 1);
+
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  if constexpr (std::is_same_v<R, detail::deduce_return_type>) {
+    return detail::inspect_likely_with(visitor, std::forward<Adt>(adt));
+  } else {
+    return detail::inspect_likely_with(
+        detail::returning<R, VisitorType>{visitor}, std::forward<Adt>(adt));
+  }
+}
+
+} // namespace adt
@@ -0,0 +1,177 @@
+/**
+ * @file inspect_each.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides InspectEach, which applies one set of handlers to every
+ *        element of a range of variants, optionals or Results, optionally
+ *        grouping variants by their active alternative first.
+ * @version 0.1
+ * @date 2026-01-06
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <array>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "inspect.hh"
+
+namespace adt {
+
+template <typename... Ts> class VariantVector;
+struct parallel_policy;
+
+namespace traits {
+// --- Detector of adt::VariantVector, which has its own InspectEach ---
+template <typename T> struct is_variant_vector_impl : std::false_type {};
+
+template <typename T>
+struct is_variant_vector
+    : is_variant_vector_impl<detail::remove_cvref_t<T>> {};
+
+// --- Detector of adt::parallel_policy, see parallel.hh ---
+template <typename T>
+struct is_parallel_policy
+    : std::is_same<detail::remove_cvref_t<T>, parallel_policy> {};
+} // namespace traits
+
+/**
+ * @brief Tag selecting the type-partitioned execution of InspectEach.
+ */
+struct partitioned_t {
+  explicit constexpr partitioned_t() = default;
+};
+inline constexpr partitioned_t partitioned{};
+
+namespace detail {
+
+template <typename Range>
+using range_reference_t = decltype(*std::begin(std::declval<Range &>()));
+
+template <typename Range, typename... Lambdas>
+constexpr void validate_each() {
+  using VisitorType = detail::visitor_t<Lambdas...>;
+  validate_inspectable<VisitorType &, range_reference_t<Range>>();
+}
+
+/**
+ * @brief Runs the handler of alternative I over a dense run of elements
+ *        that all hold that alternative.
+ */
+template <std::size_t I, typename Element, typename Visitor, typename Pointer>
+void inspect_run(Visitor &visitor, Pointer const *first, Pointer const *last) {
+  for (; first != last; ++first) {
+    visitor(get_alternative<I>(static_cast<Element>(**first)));
+  }
+}
+
+template <typename Element, typename Visitor, typename Pointer,
+          std::size_t N, std::size_t... Is>
+void inspect_runs(Visitor &visitor, const std::vector<Pointer> &order,
+                  const std::array<std::size_t, N> &offsets,
+                  std::index_sequence<Is...>) {
+  (inspect_run<Is, Element>(visitor, order.data() + offsets[Is],
+                            order.data() + offsets[Is + 1]),
+   ...);
+}
+
+} // namespace detail
+
+/**
+ * @brief Inspects every element of a range with the same handlers, in the
+ *        order of the range.
+ *
+ * @param range Any range of variants, optionals or Results, e.g.
+ *        std::vector<std::variant<...>>.
+ * @param lambdas The lambdas corresponding to each case of the element. The
+ *        visitor is built and validated once, so stateful lambdas keep their
+ *        state across elements. Their return values are discarded.
+ *
+ * @note Coverage is checked at compile time exactly like in Inspect:
+ * ```cpp
+ * std::vector<std::variant<A, B, C>> events = ...;
+ * adt::InspectEach(
+ *     events,
+ *     [&](const A &) { ++a_count; },
+ *     [&](const B &) { ++b_count; },
+ *     [&](const C &) { ++c_count; });
+ * ```
+ */
+template <typename Range, typename... Lambdas,
+          std::enable_if_t<!std::is_same_v<detail::remove_cvref_t<Range>,
+                                           partitioned_t> &&
+                               !traits::is_variant_vector<Range>::value &&
+                               !traits::is_parallel_policy<Range>::value,
+                           int> = 0>
+constexpr void InspectEach(Range &&range, Lambdas &&...lambdas) {
+  detail::validate_each<Range, Lambdas...>();
+
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  for (auto &&element : range) {
+    detail::inspect_with(visitor, std::forward<decltype(element)>(element));
+  }
+}
+
+/**
+ * @brief Type-partitioned InspectEach: a histogram pass over `index()` groups
+ *        the elements by alternative, then every handler runs over one dense
+ *        run of same-typed elements.
+ *
+ * @details On mixed streams this trades one counting-sort pass and a
+ *          temporary array of pointers for branch-free inner loops, which
+ *          keeps the branch predictor and the instruction cache warm.
+ *
+ * @warning The handlers are invoked grouped by alternative, not in the order
+ *          of the range. Within one alternative the range order is kept.
+ *
+ * @note Usage:
+ * ```cpp
+ * adt::InspectEach(adt::partitioned, events,
+ *                  [&](const A &a) { sum_a += a.value; },
+ *                  [&](const auto &) { ++others; });
+ * ```
+ */
+template <typename Range, typename... Lambdas,
+          std::enable_if_t<!traits::is_variant_vector<Range>::value, int> = 0>
+void InspectEach(partitioned_t, Range &&range, Lambdas &&...lambdas) {
+  using Element = detail::range_reference_t<Range>;
+  static_assert(
+      traits::is_variant<Element>::value,
+      "❌ INSPECT ERROR: partitioned InspectEach expects a range of "
+      "std::variant!");
+  detail::validate_each<Range, Lambdas...>();
+
+  static_assert(std::is_lvalue_reference_v<Element>,
+                "❌ INSPECT ERROR: partitioned InspectEach needs a range of "
+                "lvalues, e.g. a container, not a generated view!");
+  using Pointer = std::remove_reference_t<Element> *;
+  constexpr std::size_t N =
+      std::variant_size_v<detail::remove_cvref_t<Element>>;
+
+  // Histogram of alternatives, turned into the start offset of every run
+  std::array<std::size_t, N + 1> offsets{};
+  for (auto &element : range) {
+    if (element.valueless_by_exception()) {
+      detail::bad_variant_access();
+    }
+    ++offsets[element.index() + 1];
+  }
+  for (std::size_t i = 1; i <= N; ++i) {
+    offsets[i] += offsets[i - 1];
+  }
+
+  std::vector<Pointer> order(offsets[N]);
+  std::array<std::size_t, N + 1> cursors = offsets;
+  for (auto &element : range) {
+    order[cursors[element.index()]++] = std::addressof(element);
+  }
+
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  detail::inspect_runs<Element>(visitor, order, offsets,
+                                std::make_index_sequence<N>{});
+}
+
+} // namespace adt
@@ -0,0 +1,305 @@
+/**
+ * @file lazy_result.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides LazyResult, a Result computed by a producer on first
+ *        access and cached afterwards, and SharedLazyResult, its thread-safe
+ *        counterpart that evaluates exactly once among concurrent readers.
+ * @version 0.1
+ * @date 2026-01-12
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "hints.hh"
+#include "result.hh"
+
+namespace adt {
+
+namespace detail {
+
+template <typename F>
+using producer_result_t = std::decay_t<std::invoke_result_t<F &>>;
+
+template <typename F> struct producer_check {
+  static_assert(is_result<producer_result_t<F>>::value,
+                "❌ LAZY ERROR: the producer of a LazyResult must return an "
+                "adt::Result!");
+  using type = producer_result_t<F>;
+};
+
+template <typename F> using produced_t = typename producer_check<F>::type;
+
+/**
+ * @brief The accessors of a Result, forwarded to the outcome that the
+ *        Derived lazy type computes on first use. They make the lazy types
+ *        Expected-like, so Inspect accepts them as they are.
+ *
+ * @note Accessing an rvalue lazy moves out of its cached outcome. None of
+ *       the accessors is noexcept: any of them may run a throwing producer.
+ */
+template <typename Derived, typename T, typename E> class lazy_result_access {
+  Result<T, E> &outcome() const {
+    return static_cast<const Derived &>(*this).force();
+  }
+
+public:
+  using value_type = T;
+  using error_type = E;
+
+  [[nodiscard]] bool has_value() const { return outcome().has_value(); }
+  [[nodiscard]] bool has_error() const { return outcome().has_error(); }
+  explicit operator bool() const { return has_value(); }
+
+  /**
+   * @brief The outcome itself, evaluating it if needed.
+   */
+  [[nodiscard]] const Result<T, E> &get() const { return outcome(); }
+
+  [[nodiscard]] decltype(auto) value() & { return outcome().value(); }
+  [[nodiscard]] decltype(auto) value() const & {
+    return std::as_const(outcome()).value();
+  }
+  [[nodiscard]] decltype(auto) value() && {
+    return std::move(outcome()).value();
+  }
+
+  [[nodiscard]] decltype(auto) error() & { return outcome().error(); }
+  [[nodiscard]] decltype(auto) error() const & {
+    return std::as_const(outcome()).error();
+  }
+  [[nodiscard]] decltype(auto) error() && {
+    return std::move(outcome()).error();
+  }
+
+  [[nodiscard]] decltype(auto) unsafe_value() & {
+    return outcome().unsafe_value();
+  }
+  [[nodiscard]] decltype(auto) unsafe_value() const & {
+    return std::as_const(outcome()).unsafe_value();
+  }
+  [[nodiscard]] decltype(auto) unsafe_value() && {
+    return std::move(outcome()).unsafe_value();
+  }
+
+  [[nodiscard]] decltype(auto) unsafe_error() & {
+    return outcome().unsafe_error();
+  }
+  [[nodiscard]] decltype(auto) unsafe_error() const & {
+    return std::as_const(outcome()).unsafe_error();
+  }
+  [[nodiscard]] decltype(auto) unsafe_error() && {
+    return std::move(outcome()).unsafe_error();
+  }
+
+  template <typename U> [[nodiscard]] T value_or(U &&other) const & {
+    return std::as_const(outcome()).value_or(std::forward<U>(other));
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief A Result<T, E> that is only computed when it is first looked at:
+ *        has_value(), value(), error() or Inspect run the producer once and
+ *        cache its outcome for every later access.
+ *
+ * @details The producer is stored by value; with the default std::function
+ *          any callable fits, while `LazyResult lazy(f)` (or adt::lazy(f))
+ *          keeps the exact callable type and needs no allocation. When the
+ *          producer throws, nothing is cached and the next access retries.
+ *
+ * @warning Not thread-safe: use SharedLazyResult when several threads may
+ *          trigger the evaluation.
+ *
+ * @note Usage:
+ * ```cpp
+ * adt::LazyResult resolved([&] { return resolve_config(path); });
+ * if (needs_config) {
+ *   adt::Inspect(resolved, [](const Config &config) { ... },
+ *                [](ConfigError err) { ... });
+ * }
+ * ```
+ */
+template <typename T, typename E,
+          typename Producer = std::function<Result<T, E>()>>
+class LazyResult : public detail::lazy_result_access<
+                       LazyResult<T, E, Producer>, T, E> {
+  template <typename, typename, typename>
+  friend class detail::lazy_result_access;
+
+  mutable Producer _producer;
+  mutable std::optional<Result<T, E>> _outcome;
+
+  Result<T, E> &force() const {
+    if (ADT_UNLIKELY(!_outcome.has_value())) {
+      _outcome.emplace(std::invoke(_producer));
+    }
+    return *_outcome;
+  }
+
+public:
+  using producer_type = Producer;
+
+  template <typename F,
+            std::enable_if_t<!std::is_same_v<std::decay_t<F>, LazyResult> &&
+                                 std::is_constructible_v<Producer, F &&>,
+                             int> = 0>
+  explicit LazyResult(F &&producer) : _producer(std::forward<F>(producer)) {
+    static_assert(std::is_same_v<detail::produced_t<Producer>, Result<T, E>>,
+                  "❌ LAZY ERROR: the producer must return exactly "
+                  "Result<T, E>!");
+  }
+
+  /**
+   * @brief Whether the producer has already run.
+   */
+  [[nodiscard]] bool evaluated() const noexcept {
+    return _outcome.has_value();
+  }
+};
+
+template <typename F>
+LazyResult(F) -> LazyResult<typename detail::produced_t<F>::value_type,
+                            typename detail::produced_t<F>::error_type, F>;
+
+/**
+ * @brief The thread-safe LazyResult: concurrent readers run the producer
+ *        exactly once, the others wait for its outcome. Once evaluated, an
+ *        access costs one acquire load.
+ *
+ * @details The state goes from unevaluated to running under a
+ *          compare-exchange, the winner runs the producer and publishes the
+ *          outcome with a release store. Waiters block with atomic wait
+ *          where available (C++20) and yield otherwise. When the producer
+ *          throws, the state goes back to unevaluated and another reader
+ *          retries, as with std::call_once.
+ *
+ * @warning Neither copyable nor movable. Rvalue access moves out of the
+ *          shared outcome, so use it only once all readers are done.
+ */
+template <typename T, typename E,
+          typename Producer = std::function<Result<T, E>()>>
+class SharedLazyResult
+    : public detail::lazy_result_access<SharedLazyResult<T, E, Producer>, T,
+                                        E> {
+  template <typename, typename, typename>
+  friend class detail::lazy_result_access;
+
+  enum state : std::uint8_t { unevaluated, running, ready };
+
+  mutable std::atomic<std::uint8_t> _state{unevaluated};
+  mutable Producer _producer;
+  mutable std::optional<Result<T, E>> _outcome;
+
+  Result<T, E> &force() const {
+    if (ADT_LIKELY(_state.load(std::memory_order_acquire) == ready)) {
+      return *_outcome;
+    }
+    return evaluate();
+  }
+
+  /**
+   * @brief Sets the state back to unevaluated when the producer throws.
+   */
+  struct reset_on_unwind {
+    std::atomic<std::uint8_t> &state;
+    bool armed = true;
+
+    ~reset_on_unwind() {
+      if (armed) {
+        state.store(unevaluated, std::memory_order_release);
+        notify(state);
+      }
+    }
+  };
+
+  static void notify(std::atomic<std::uint8_t> &state) noexcept {
+#if defined(__cpp_lib_atomic_wait)
+    state.notify_all();
+#else
+    static_cast<void>(state);
+#endif
+  }
+
+  static void wait_while_running(std::atomic<std::uint8_t> &state) noexcept {
+#if defined(__cpp_lib_atomic_wait)
+    state.wait(running, std::memory_order_acquire);
+#else
+    static_cast<void>(state);
+    std::this_thread::yield();
+#endif
+  }
+
+  ADT_COLD Result<T, E> &evaluate() const {
+    for (;;) {
+      std::uint8_t current = _state.load(std::memory_order_acquire);
+      if (current == ready) {
+        return *_outcome;
+      }
+      if (current == unevaluated &&
+          _state.compare_exchange_weak(current, running,
+                                       std::memory_order_acquire)) {
+        reset_on_unwind guard{_state};
+        _outcome.emplace(std::invoke(_producer));
+        guard.armed = false;
+        _state.store(ready, std::memory_order_release);
+        notify(_state);
+        return *_outcome;
+      }
+      if (current == running) {
+        wait_while_running(_state);
+      }
+    }
+  }
+
+public:
+  using producer_type = Producer;
+
+  template <typename F,
+            std::enable_if_t<
+                !std::is_same_v<std::decay_t<F>, SharedLazyResult> &&
+                    std::is_constructible_v<Producer, F &&>,
+                int> = 0>
+  explicit SharedLazyResult(F &&producer)
+      : _producer(std::forward<F>(producer)) {
+    static_assert(std::is_same_v<detail::produced_t<Producer>, Result<T, E>>,
+                  "❌ LAZY ERROR: the producer must return exactly "
+                  "Result<T, E>!");
+  }
+
+  SharedLazyResult(const SharedLazyResult &) = delete;
+  SharedLazyResult &operator=(const SharedLazyResult &) = delete;
+
+  [[nodiscard]] bool evaluated() const noexcept {
+    return _state.load(std::memory_order_acquire) == ready;
+  }
+};
+
+template <typename F>
+SharedLazyResult(F)
+    -> SharedLazyResult<typename detail::produced_t<F>::value_type,
+                        typename detail::produced_t<F>::error_type, F>;
+
+/**
+ * @brief Wraps a producer returning Result<T, E> into a LazyResult that
+ *        keeps its exact type.
+ */
+template <typename F>
+[[nodiscard]] auto lazy(F &&producer) {
+  using Produced = detail::produced_t<std::decay_t<F>>;
+  return LazyResult<typename Produced::value_type,
+                    typename Produced::error_type, std::decay_t<F>>(
+      std::forward<F>(producer));
+}
+
+} // namespace adt
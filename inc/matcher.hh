@@ -0,0 +1,256 @@
+/**
+ * @file matcher.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides Matcher, a handler set for a std::variant erased into one
+ *        small-buffer object with an inline per-alternative function table,
+ *        built once and applied many times.
+ * @version 0.1
+ * @date 2026-01-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "hints.hh"
+#include "inspect.hh"
+
+namespace adt {
+
+namespace detail {
+
+/**
+ * @brief Default size of the buffer in which a Matcher stores its handlers
+ *        without allocating: four pointers' worth of captures.
+ */
+inline constexpr std::size_t matcher_buffer_size = 4 * sizeof(void *);
+
+/**
+ * @brief How a Matcher takes the variant: as given when Variant is a
+ *        reference type, by const reference otherwise.
+ */
+template <typename Variant>
+using matched_t = std::conditional_t<std::is_reference_v<Variant>, Variant,
+                                     const Variant &>;
+
+/**
+ * @brief The type-erased lifetime operations of the stored visitor.
+ */
+struct matcher_ops {
+  void (*destroy)(void *storage) noexcept;
+  void (*copy)(const void *from, void *to);
+  void (*move)(void *from, void *to) noexcept;
+  bool stored_inline;
+};
+
+/**
+ * @brief Stores a Visitor inside the buffer when it fits (size, alignment
+ *        and a non-throwing move), and on the heap otherwise, keeping the
+ *        pointer in the buffer.
+ */
+template <typename Visitor, std::size_t Capacity> struct matcher_storage {
+  static constexpr bool stored_inline =
+      sizeof(Visitor) <= Capacity &&
+      alignof(Visitor) <= alignof(std::max_align_t) &&
+      std::is_nothrow_move_constructible_v<Visitor>;
+
+  static const Visitor *get(const void *storage) noexcept {
+    if constexpr (stored_inline) {
+      return std::launder(static_cast<const Visitor *>(storage));
+    } else {
+      return *std::launder(static_cast<Visitor *const *>(storage));
+    }
+  }
+
+  static Visitor *get(void *storage) noexcept {
+    return const_cast<Visitor *>(get(static_cast<const void *>(storage)));
+  }
+
+  template <typename... Args>
+  static void create(void *storage, Args &&...args) {
+    if constexpr (stored_inline) {
+      ::new (storage) Visitor(std::forward<Args>(args)...);
+    } else {
+      ::new (storage) Visitor *(new Visitor(std::forward<Args>(args)...));
+    }
+  }
+
+  static void destroy(void *storage) noexcept {
+    if constexpr (stored_inline) {
+      get(storage)->~Visitor();
+    } else {
+      delete get(storage);
+    }
+  }
+
+  static void copy(const void *from, void *to) { create(to, *get(from)); }
+
+  static void move(void *from, void *to) noexcept {
+    if constexpr (stored_inline) {
+      create(to, std::move(*get(from)));
+    } else {
+      // The heap object changes hands, the source keeps a null pointer
+      ::new (to) Visitor *(get(from));
+      *std::launder(static_cast<Visitor **>(from)) = nullptr;
+    }
+  }
+
+  static constexpr matcher_ops ops{&destroy, &copy, &move, stored_inline};
+};
+
+template <typename R, typename Storage, typename Visitor, typename Matched,
+          std::size_t I>
+R invoke_alternative(const void *storage, Matched variant) {
+  const Visitor &visitor = *Storage::get(storage);
+  return returning<R, const Visitor>{visitor}(
+      get_alternative<I>(std::forward<Matched>(variant)));
+}
+
+} // namespace detail
+
+/**
+ * @brief A complete handler set for a std::variant, erased into one object:
+ *        the handlers live in a small inline buffer (on the heap only when
+ *        their captures do not fit) and each alternative has an entry in an
+ *        inline table of function pointers. Applying it is one indexed
+ *        indirect call, with no visitor built per call.
+ *
+ * @details Handlers are checked by the same variant_validator as Inspect
+ *          when the Matcher is constructed. They are called as const, like
+ *          the visitor of the parallel forms, and every result is turned
+ *          into R as with Inspect<R>. Patterns (adt::when, eq, range) work
+ *          as well. Copying a Matcher copies its handlers; a moved-from
+ *          Matcher may only be assigned to or destroyed.
+ *
+ * @tparam Variant The variant type, taken by const reference; pass a
+ *         reference type (`std::variant<...> &` or `&&`) to take it so.
+ * @tparam R The return type of every call.
+ * @tparam Capacity Bytes of handler state stored without allocating.
+ *
+ * @note Usage, with the handlers picked at run time:
+ * ```cpp
+ * using Decoder = adt::Matcher<Message, Reply>;
+ * Decoder strict([&](const Ping &p) { return pong(p); },
+ *                [&](const Data &d) { return store(limits, d); });
+ * Decoder lenient(...);
+ * const Decoder &decode = config.strict ? strict : lenient;
+ * for (const Message &message : inbox) {
+ *   send(decode(message));
+ * }
+ * ```
+ */
+template <typename Variant, typename R = void,
+          std::size_t Capacity = detail::matcher_buffer_size>
+class Matcher {
+  using raw_variant = detail::remove_cvref_t<Variant>;
+  using matched = detail::matched_t<Variant>;
+  using invoker = R (*)(const void *, matched);
+
+  static_assert(traits::is_variant<raw_variant>::value,
+                "❌ MATCHER ERROR: a Matcher applies to a std::variant!");
+
+  static constexpr std::size_t alternatives =
+      std::variant_size_v<raw_variant>;
+  static constexpr std::size_t buffer_size =
+      Capacity < sizeof(void *) ? sizeof(void *) : Capacity;
+
+  alignas(std::max_align_t) unsigned char _storage[buffer_size];
+  const detail::matcher_ops *_ops;
+  std::array<invoker, alternatives> _invoke;
+
+  template <typename Storage, typename Visitor, std::size_t... Is>
+  static constexpr std::array<invoker, alternatives>
+  make_table(std::index_sequence<Is...>) noexcept {
+    return {&detail::invoke_alternative<R, Storage, Visitor, matched, Is>...};
+  }
+
+  template <typename First, typename... Rest>
+  static constexpr bool is_self_v =
+      sizeof...(Rest) == 0 && std::is_same_v<detail::remove_cvref_t<First>,
+                                             Matcher>;
+
+public:
+  using variant_type = Variant;
+  using result_type = R;
+
+  /**
+   * @brief Builds the handler set from lambdas (and patterns), as Inspect
+   *        would, and checks it covers every alternative.
+   */
+  template <typename First, typename... Rest,
+            std::enable_if_t<!is_self_v<First, Rest...>, int> = 0>
+  explicit Matcher(First &&first, Rest &&...rest) {
+    using Visitor = detail::visitor_t<First, Rest...>;
+    using Storage = detail::matcher_storage<Visitor, buffer_size>;
+    diagnostic::variant_validator<const Visitor, matched>::validate();
+    static_assert(std::is_copy_constructible_v<Visitor>,
+                  "❌ MATCHER ERROR: the handlers of a Matcher must be copy "
+                  "constructible!");
+
+    Storage::create(_storage,
+                    detail::make_visitor(std::forward<First>(first),
+                                         std::forward<Rest>(rest)...));
+    _ops = &Storage::ops;
+    _invoke = make_table<Storage, Visitor>(
+        std::make_index_sequence<alternatives>{});
+  }
+
+  Matcher(const Matcher &other) : _ops(other._ops), _invoke(other._invoke) {
+    _ops->copy(other._storage, _storage);
+  }
+
+  Matcher(Matcher &&other) noexcept
+      : _ops(other._ops), _invoke(other._invoke) {
+    _ops->move(other._storage, _storage);
+  }
+
+  Matcher &operator=(const Matcher &other) {
+    if (this != &other) {
+      Matcher copy(other);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  Matcher &operator=(Matcher &&other) noexcept {
+    if (this != &other) {
+      _ops->destroy(_storage);
+      _ops = other._ops;
+      _invoke = other._invoke;
+      _ops->move(other._storage, _storage);
+    }
+    return *this;
+  }
+
+  ~Matcher() { _ops->destroy(_storage); }
+
+  /**
+   * @brief Applies the handler of the active alternative.
+   *
+   * @throws std::bad_variant_access when the variant is valueless.
+   */
+  R operator()(matched variant) const {
+    const std::size_t index = variant.index();
+    if (ADT_UNLIKELY(index >= alternatives)) {
+      detail::bad_variant_access();
+    }
+    return _invoke[index](_storage, std::forward<matched>(variant));
+  }
+
+  /**
+   * @brief Whether the handlers are stored in the inline buffer, i.e. the
+   *        Matcher did not allocate.
+   */
+  [[nodiscard]] bool stored_inline() const noexcept {
+    return _ops->stored_inline;
+  }
+};
+
+} // namespace adt
@@ -0,0 +1,66 @@
+/**
+ * @file niche.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides the niche_traits customization point, which describes a
+ *        bit pattern a type never uses for a valid value. adt::Result and
+ *        adt::Optional store their discriminant in that pattern instead of
+ *        a separate tag (as Rust does for references and NonZero types).
+ * @version 0.1
+ * @date 2026-01-04
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <type_traits>
+
+namespace adt {
+
+/**
+ * @brief Describes a spare ("niche") value of T. The primary template says
+ *        that T has none.
+ *
+ * @note To opt a type in, specialize this template and provide:
+ * ```cpp
+ * static constexpr bool available = true;
+ * static constexpr T sentinel() noexcept;               // never a valid T
+ * static constexpr bool is_sentinel(const T &) noexcept;
+ * ```
+ *       For enums and pointers the sentinel_niche helper does that for you:
+ * ```cpp
+ * enum class ErrorCode : std::uint8_t { NONE, TIMEOUT, CLOSED };
+ * template <>
+ * struct adt::niche_traits<ErrorCode>
+ *     : adt::sentinel_niche<ErrorCode, ErrorCode::NONE> {};
+ *
+ * template <>
+ * struct adt::niche_traits<Node *> : adt::sentinel_niche<Node *, nullptr> {};
+ * ```
+ *
+ * @warning Raw pointers are not opted in by default, since a null Ok(nullptr)
+ *          or Optional<T *>(nullptr) is a legitimate value for many users.
+ *          Only specialize it for types where the sentinel really is unused.
+ */
+template <typename T> struct niche_traits {
+  static constexpr bool available = false;
+};
+
+/**
+ * @brief Ready-made niche_traits body for types whose sentinel can be a
+ *        non-type template argument (enums, integers, pointers).
+ */
+template <typename T, T Sentinel> struct sentinel_niche {
+  static constexpr bool available = true;
+
+  static constexpr T sentinel() noexcept { return Sentinel; }
+  static constexpr bool is_sentinel(const T &value) noexcept {
+    return value == Sentinel;
+  }
+};
+
+template <typename T>
+inline constexpr bool has_niche_v =
+    niche_traits<std::remove_cv_t<T>>::available;
+
+} // namespace adt
@@ -0,0 +1,170 @@
+/**
+ * @file optional.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides an Optional type similar to std::optional, which stores the
+ *        empty state inside the payload for types with a niche (see
+ *        niche.hh), so that sizeof(Optional<T>) == sizeof(T).
+ * @version 0.1
+ * @date 2026-01-04
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <cassert>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <cstdlib>
+
+#include "hints.hh"
+#include "niche.hh"
+
+namespace adt {
+
+namespace detail {
+
+/**
+ * @brief Fallback storage for types without a niche, delegating to
+ *        std::optional.
+ */
+template <typename T, bool = has_niche_v<T>> struct optional_storage {
+  std::optional<T> _data;
+
+  constexpr optional_storage() noexcept = default;
+  constexpr optional_storage(T &&value) : _data(std::move(value)) {}
+  constexpr optional_storage(const T &value) : _data(value) {}
+
+  constexpr bool has_value() const noexcept { return _data.has_value(); }
+
+  constexpr T &get() noexcept { return *_data; }
+  constexpr const T &get() const noexcept { return *_data; }
+
+  constexpr void reset() noexcept { _data.reset(); }
+
+  template <typename... Args> constexpr T &emplace(Args &&...args) {
+    return _data.emplace(std::forward<Args>(args)...);
+  }
+};
+
+/**
+ * @brief Niche storage: a plain T that holds the sentinel when empty.
+ */
+template <typename T> struct optional_storage<T, true> {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "❌ NICHE ERROR: niche_traits may only be specialized for "
+                "trivially copyable types!");
+  using Niche = niche_traits<T>;
+
+  T _data;
+
+  constexpr optional_storage() noexcept : _data(Niche::sentinel()) {}
+  constexpr optional_storage(const T &value) : _data(value) {
+    assert(!Niche::is_sentinel(_data) &&
+           "Optional: value collides with the niche sentinel!");
+  }
+
+  constexpr bool has_value() const noexcept {
+    return !Niche::is_sentinel(_data);
+  }
+
+  constexpr T &get() noexcept { return _data; }
+  constexpr const T &get() const noexcept { return _data; }
+
+  constexpr void reset() noexcept { _data = Niche::sentinel(); }
+
+  template <typename... Args> constexpr T &emplace(Args &&...args) {
+    _data = T(std::forward<Args>(args)...);
+    assert(!Niche::is_sentinel(_data) &&
+           "Optional: value collides with the niche sentinel!");
+    return _data;
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief An optional value of type T, interchangeable with std::optional in
+ *        Inspect.
+ *
+ * @note When niche_traits<T> is specialized, the empty state is stored as the
+ *       sentinel of T and no separate flag is needed. Otherwise it behaves
+ *       like (and is laid out as) std::optional<T>.
+ *
+ * @warning For niche types, assigning the sentinel through operator* turns
+ *          the Optional into the empty state.
+ *
+ * @tparam T The type of the value.
+ */
+template <typename T> class Optional {
+  static_assert(!std::is_reference_v<T>, "Value type T cannot be a reference.");
+  static_assert(!std::is_void_v<T>, "Value type T cannot be void.");
+
+  detail::optional_storage<T> _storage;
+
+public:
+  constexpr Optional() noexcept = default;
+  constexpr Optional(std::nullopt_t) noexcept {}
+  constexpr Optional(T value) : _storage(std::move(value)) {}
+
+  [[nodiscard]]
+  constexpr bool has_value() const noexcept {
+    return _storage.has_value();
+  }
+  constexpr explicit operator bool() const noexcept { return has_value(); }
+
+  [[nodiscard]] constexpr T &operator*() & noexcept { return _storage.get(); }
+  [[nodiscard]] constexpr const T &operator*() const & noexcept {
+    return _storage.get();
+  }
+  [[nodiscard]] constexpr T &&operator*() && noexcept {
+    return std::move(_storage.get());
+  }
+
+  [[nodiscard]] constexpr T *operator->() noexcept {
+    return std::addressof(_storage.get());
+  }
+  [[nodiscard]] constexpr const T *operator->() const noexcept {
+    return std::addressof(_storage.get());
+  }
+
+  [[nodiscard]] constexpr T &value() & {
+    ensure_value();
+    return _storage.get();
+  }
+  [[nodiscard]] constexpr const T &value() const & {
+    ensure_value();
+    return _storage.get();
+  }
+  [[nodiscard]] constexpr T &&value() && {
+    ensure_value();
+    return std::move(_storage.get());
+  }
+
+  template <typename U> [[nodiscard]] constexpr T value_or(U &&other) const & {
+    return has_value() ? _storage.get()
+                       : static_cast<T>(std::forward<U>(other));
+  }
+  template <typename U> [[nodiscard]] constexpr T value_or(U &&other) && {
+    return has_value() ? std::move(_storage.get())
+                       : static_cast<T>(std::forward<U>(other));
+  }
+
+  constexpr void reset() noexcept { _storage.reset(); }
+
+  template <typename... Args> constexpr T &emplace(Args &&...args) {
+    return _storage.emplace(std::forward<Args>(args)...);
+  }
+
+private:
+  constexpr void ensure_value() const {
+    if (ADT_UNLIKELY(!has_value())) {
+      detail::abort_with("Optional: Attempt to access value on empty state!");
+    }
+  }
+};
+
+} // namespace adt
@@ -0,0 +1,274 @@
+/**
+ * @file parallel.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides parallel forms of InspectEach and a (parallel) reduction,
+ *        InspectReduce, over random-access ranges of variants, optionals or
+ *        Results.
+ * @version 0.1
+ * @date 2026-01-08
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "inspect_each.hh"
+
+namespace adt {
+
+/**
+ * @brief Execution policy of the parallel range forms.
+ *
+ * @details The range is cut into chunks of `grain` elements. Worker threads
+ *          (the calling thread included) repeatedly claim the next unclaimed
+ *          chunk from a shared atomic counter, so a thread that finishes early
+ *          keeps taking work from the others, as in work stealing.
+ *
+ * @note std::execution::par_unseq is not used: libstdc++ needs TBB for it and
+ *       it has no way to bound the number of threads or the chunk size.
+ */
+struct parallel_policy {
+  /// Number of threads; 0 means std::thread::hardware_concurrency()
+  std::size_t threads = 0;
+  /// Number of elements processed by a thread in one go
+  std::size_t grain = 16384;
+};
+
+/**
+ * @brief Default parallel policy: all hardware threads, 16384 elements per
+ *        chunk.
+ */
+inline constexpr parallel_policy parallel{};
+
+namespace detail {
+
+template <typename Range>
+constexpr void validate_random_access() {
+  using Iterator = decltype(std::begin(std::declval<Range &>()));
+  static_assert(
+      std::is_base_of_v<
+          std::random_access_iterator_tag,
+          typename std::iterator_traits<Iterator>::iterator_category>,
+      "❌ INSPECT ERROR: the parallel forms need a random-access range!");
+}
+
+/**
+ * @brief Calls `body(first, last, chunk)` for every chunk of [0, size), on up
+ *        to `policy.threads` threads. The first exception thrown by a chunk
+ *        is rethrown on the calling thread once all workers are joined, as
+ *        is the std::system_error of a helper thread that could not start.
+ */
+template <typename Body>
+void parallel_chunks(const parallel_policy &policy, std::size_t size,
+                     Body &&body) {
+  const std::size_t grain = std::max<std::size_t>(policy.grain, 1);
+  const std::size_t chunks = (size + grain - 1) / grain;
+  const std::size_t threads =
+      std::min(policy.threads != 0
+                   ? policy.threads
+                   : std::max<std::size_t>(std::thread::hardware_concurrency(),
+                                           1),
+               chunks);
+
+  auto run_chunk = [&](std::size_t chunk) {
+    const std::size_t first = chunk * grain;
+    body(first, std::min(first + grain, size), chunk);
+  };
+
+  if (threads <= 1) {
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+      run_chunk(chunk);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next_chunk{0};
+  std::exception_ptr failure;
+  std::mutex failure_mutex;
+
+  auto worker = [&] {
+    for (;;) {
+      const std::size_t chunk =
+          next_chunk.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= chunks) {
+        return;
+      }
+      try {
+        run_chunk(chunk);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(failure_mutex);
+        if (!failure) {
+          failure = std::current_exception();
+        }
+        // Stop handing out further chunks
+        next_chunk.store(chunks, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  std::vector<std::thread> helpers;
+  helpers.reserve(threads - 1);
+  try {
+    for (std::size_t i = 1; i < threads; ++i) {
+      helpers.emplace_back(worker);
+    }
+  } catch (...) {
+    // A helper could not be started: let those that were finish their
+    // current chunk, before their std::thread is destroyed
+    next_chunk.store(chunks, std::memory_order_relaxed);
+    for (auto &helper : helpers) {
+      helper.join();
+    }
+    throw;
+  }
+  worker();
+  for (auto &helper : helpers) {
+    helper.join();
+  }
+
+  if (failure) {
+    std::rethrow_exception(failure);
+  }
+}
+
+/**
+ * @brief Checks the handlers the way the parallel forms call them: as const,
+ *        through the one visitor all threads share.
+ */
+template <typename Range, typename... Lambdas>
+constexpr void validate_shared_each() {
+  using VisitorType = visitor_t<Lambdas...>;
+  validate_inspectable<const VisitorType &, range_reference_t<Range>>();
+}
+
+} // namespace detail
+
+/**
+ * @brief Parallel InspectEach: inspects every element of a random-access
+ *        range, splitting the range across threads.
+ *
+ * @warning The handlers are called concurrently from several threads and in
+ *          no particular order, so they must be thread-safe. The visitor is
+ *          shared by all threads, not copied.
+ *
+ * @note Usage:
+ * ```cpp
+ * std::vector<adt::Result<Record, ErrorCode>> batch = ...;
+ * std::atomic<std::size_t> failures{0};
+ * adt::InspectEach(adt::parallel, batch,
+ *                  [](const Record &record) { validate(record); },
+ *                  [&](ErrorCode) { ++failures; });
+ * ```
+ */
+template <typename Policy, typename Range, typename... Lambdas,
+          std::enable_if_t<traits::is_parallel_policy<Policy>::value, int> = 0>
+void InspectEach(const Policy &policy, Range &&range, Lambdas &&...lambdas) {
+  detail::validate_shared_each<Range, Lambdas...>();
+  detail::validate_random_access<Range>();
+
+  const auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  const auto first = std::begin(range);
+  const auto size = static_cast<std::size_t>(std::size(range));
+
+  detail::parallel_chunks(
+      policy, size, [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t i = begin; i < end; ++i) {
+          detail::inspect_with(visitor, first[i]);
+        }
+      });
+}
+
+/**
+ * @brief Inspects every element of a range and combines the results of the
+ *        handlers with `op`, starting from `init`.
+ *
+ * @param init The initial value of the reduction, combined exactly once.
+ * @param op A binary operation `T(T, Handled)`, where Handled is the type
+ *        returned by the handlers.
+ * @return `op(...op(op(init, h(e0)), h(e1))..., h(eN))`.
+ *
+ * @note Usage:
+ * ```cpp
+ * auto valid = adt::InspectReduce(
+ *     batch, std::size_t{0}, std::plus<>{},
+ *     [](const Record &) { return std::size_t{1}; },
+ *     [](ErrorCode) { return std::size_t{0}; });
+ * ```
+ */
+template <typename Range, typename T, typename Op, typename... Lambdas,
+          std::enable_if_t<!traits::is_parallel_policy<Range>::value, int> = 0>
+T InspectReduce(Range &&range, T init, Op op, Lambdas &&...lambdas) {
+  detail::validate_each<Range, Lambdas...>();
+
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  for (auto &&element : range) {
+    init = op(std::move(init),
+              detail::inspect_with(visitor,
+                                   std::forward<decltype(element)>(element)));
+  }
+  return init;
+}
+
+/**
+ * @brief Parallel InspectReduce: every chunk is reduced on its own thread,
+ *        then the partial results are combined in the order of the chunks.
+ *
+ * @details A chunk starts from the result of its first handler and the
+ *          partials are combined with `op` as well, so here `op` is
+ *          `T(T, T)` and the handlers must return T itself.
+ *
+ * @warning `op` must be associative over T (it need not be commutative) and
+ *          the handlers must be thread-safe. `init` is combined exactly once,
+ *          so it does not have to be the identity of `op`.
+ */
+template <typename Policy, typename Range, typename T, typename Op,
+          typename... Lambdas,
+          std::enable_if_t<traits::is_parallel_policy<Policy>::value, int> = 0>
+T InspectReduce(const Policy &policy, Range &&range, T init, Op op,
+                Lambdas &&...lambdas) {
+  detail::validate_shared_each<Range, Lambdas...>();
+  detail::validate_random_access<Range>();
+
+  const auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  const auto first = std::begin(range);
+  using Handled = decltype(detail::inspect_with(visitor, first[0]));
+  static_assert(std::is_same_v<detail::remove_cvref_t<Handled>, T>,
+                "❌ INSPECT ERROR: the handlers of a parallel InspectReduce "
+                "must return the type of `init`, as `op` also combines the "
+                "partial results of the chunks!");
+  static_assert(std::is_invocable_r_v<T, Op &, T, T>,
+                "❌ INSPECT ERROR: the `op` of a parallel InspectReduce must "
+                "be callable as T(T, T)!");
+
+  const auto size = static_cast<std::size_t>(std::size(range));
+  const std::size_t grain = std::max<std::size_t>(policy.grain, 1);
+
+  std::vector<std::optional<T>> partials((size + grain - 1) / grain);
+  detail::parallel_chunks(
+      policy, size,
+      [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+        T partial = detail::inspect_with(visitor, first[begin]);
+        for (std::size_t i = begin + 1; i < end; ++i) {
+          partial = op(std::move(partial),
+                       detail::inspect_with(visitor, first[i]));
+        }
+        partials[chunk] = std::move(partial);
+      });
+
+  for (auto &partial : partials) {
+    init = op(std::move(init), std::move(*partial));
+  }
+  return init;
+}
+
+} // namespace adt
@@ -0,0 +1,533 @@
+/**
+ * @file pipeline.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides Pipeline, a chain of Result stages run concurrently on
+ *        batches of items, with errors sent straight to a sink and per-stage
+ *        throughput and error-rate counters.
+ * @version 0.1
+ * @date 2026-01-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hints.hh"
+#include "result.hh"
+
+namespace adt {
+
+/**
+ * @brief Execution policy of a Pipeline.
+ */
+struct pipeline_policy {
+  /// Number of items handed from one stage to the next in one go
+  std::size_t batch = 256;
+  /// Number of batches waiting between two stages before the stage feeding
+  /// them blocks (backpressure)
+  std::size_t queue_capacity = 8;
+};
+
+/**
+ * @brief Counters of one stage, accumulated over every run of a Pipeline.
+ */
+struct stage_stats {
+  /// Items the stage was called with
+  std::uint64_t items = 0;
+  /// Items the stage turned into errors
+  std::uint64_t errors = 0;
+  /// Time spent in the stage function, excluding waits on the queues
+  std::chrono::nanoseconds busy{0};
+
+  /**
+   * @brief Items processed per second of busy time.
+   */
+  [[nodiscard]] double throughput() const noexcept {
+    return busy.count() == 0 ? 0.0
+                             : static_cast<double>(items) * 1e9 /
+                                   static_cast<double>(busy.count());
+  }
+
+  [[nodiscard]] double error_rate() const noexcept {
+    return items == 0 ? 0.0
+                      : static_cast<double>(errors) /
+                            static_cast<double>(items);
+  }
+};
+
+namespace detail {
+
+inline constexpr std::size_t cache_line_size = 64;
+
+/**
+ * @brief Bounded lock-free queue between one producer and one consumer
+ *        thread. The producer closes it after its last push.
+ */
+template <typename T> class spsc_queue {
+  std::unique_ptr<T[]> _slots;
+  std::size_t _mask;
+
+  alignas(cache_line_size) std::atomic<std::size_t> _head{0};
+  alignas(cache_line_size) std::atomic<std::size_t> _tail{0};
+  alignas(cache_line_size) std::atomic<bool> _closed{false};
+
+  static std::size_t round_up(std::size_t capacity) noexcept {
+    std::size_t rounded = 1;
+    while (rounded < capacity) {
+      rounded <<= 1;
+    }
+    return rounded;
+  }
+
+public:
+  explicit spsc_queue(std::size_t capacity)
+      : _slots(std::make_unique<T[]>(round_up(capacity))),
+        _mask(round_up(capacity) - 1) {}
+
+  bool try_push(T &value) {
+    const std::size_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _head.load(std::memory_order_acquire) > _mask) {
+      return false;
+    }
+    _slots[tail & _mask] = std::move(value);
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool try_pop(T &out) {
+    const std::size_t head = _head.load(std::memory_order_relaxed);
+    if (head == _tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+    out = std::move(_slots[head & _mask]);
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  void close() noexcept { _closed.store(true, std::memory_order_release); }
+
+  /**
+   * @brief Pushes `value`, waiting while the queue is full. Returns false
+   *        when `stopped` is raised first.
+   */
+  bool push(T &value, const std::atomic<bool> &stopped) {
+    while (!try_push(value)) {
+      if (stopped.load(std::memory_order_relaxed)) {
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+  /**
+   * @brief Pops into `out`, waiting while the queue is empty. Returns false
+   *        once the queue is closed and drained, or when `stopped` is raised.
+   */
+  bool pop(T &out, const std::atomic<bool> &stopped) {
+    while (!try_pop(out)) {
+      if (_closed.load(std::memory_order_acquire)) {
+        // Pushes made before close() are visible now
+        return try_pop(out);
+      }
+      if (stopped.load(std::memory_order_relaxed)) {
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief The live counters of a stage, read while a run is in progress.
+ */
+struct alignas(cache_line_size) stage_counters {
+  std::atomic<std::uint64_t> items{0};
+  std::atomic<std::uint64_t> errors{0};
+  std::atomic<std::uint64_t> busy_ns{0};
+
+  void record(std::size_t batch, std::size_t failed,
+              std::chrono::nanoseconds busy) noexcept {
+    items.fetch_add(batch, std::memory_order_relaxed);
+    errors.fetch_add(failed, std::memory_order_relaxed);
+    busy_ns.fetch_add(static_cast<std::uint64_t>(busy.count()),
+                      std::memory_order_relaxed);
+  }
+
+  stage_stats snapshot() const noexcept {
+    return {items.load(std::memory_order_relaxed),
+            errors.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds(
+                busy_ns.load(std::memory_order_relaxed))};
+  }
+
+  void reset() noexcept {
+    items.store(0, std::memory_order_relaxed);
+    errors.store(0, std::memory_order_relaxed);
+    busy_ns.store(0, std::memory_order_relaxed);
+  }
+};
+
+template <typename F, typename In>
+using stage_return_t = std::decay_t<std::invoke_result_t<F &, In &&>>;
+
+/**
+ * @brief The value type a stage produces from In: the value type of the
+ *        Result it returns (as with and_then), or what it returns (as with
+ *        map).
+ */
+template <typename F, typename In, typename E, typename = void>
+struct stage_output {
+  static_assert(std::is_invocable_v<F &, In &&>,
+                "❌ PIPELINE ERROR: a stage cannot be called with the value "
+                "produced by the previous stage!");
+};
+
+template <typename F, typename In, typename E>
+struct stage_output<F, In, E,
+                    std::enable_if_t<std::is_invocable_v<F &, In &&>>> {
+  using returned = stage_return_t<F, In>;
+  static constexpr bool fallible = is_result<returned>::value;
+
+  template <typename R, bool = is_result<R>::value> struct unwrap {
+    using type = R;
+  };
+  template <typename R> struct unwrap<R, true> {
+    static_assert(std::is_same_v<typename R::error_type, E>,
+                  "❌ PIPELINE ERROR: a stage must return Result<T, E> with "
+                  "the error type of the pipeline!");
+    using type = typename R::value_type;
+  };
+
+  using type = typename unwrap<returned>::type;
+  static_assert(!std::is_void_v<type>,
+                "❌ PIPELINE ERROR: a stage must produce a value for the next "
+                "one!");
+};
+
+template <typename F, typename In, typename E>
+using stage_output_t = typename stage_output<F, In, E>::type;
+
+/**
+ * @brief std::tuple of the value types entering every stage, followed by
+ *        the type produced by the last one.
+ */
+template <typename E, typename In, typename... Stages> struct stage_values {
+  using type = std::tuple<In>;
+};
+
+template <typename E, typename In, typename Stage, typename... Stages>
+struct stage_values<E, In, Stage, Stages...> {
+  using type = decltype(std::tuple_cat(
+      std::declval<std::tuple<In>>(),
+      std::declval<typename stage_values<
+          E, stage_output_t<Stage, In, E>, Stages...>::type>()));
+};
+
+template <typename Result> decltype(auto) moved_error(Result &&result) {
+  if constexpr (std::is_same_v<typename Result::value_type,
+                               typename Result::error_type>) {
+    return std::move(result).unsafe_error().get();
+  } else {
+    return std::move(result).unsafe_error();
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief A chain of stages turning items of type In into Results, each
+ *        stage running on its own thread and fed through a bounded
+ *        lock-free queue.
+ *
+ * @details A stage takes the value produced by the previous one and returns
+ *          either Result<Out, E>, like the argument of and_then, or a plain
+ *          Out, like the argument of map. Items travel in batches of
+ *          `policy.batch`. An item whose stage fails leaves its batch on the
+ *          spot and goes to the error sink, so later stages never see it.
+ *          When a queue holds `policy.queue_capacity` batches, the stage
+ *          feeding it waits, so a slow stage holds back the ones before it
+ *          instead of buffering without bound. stats() tells which stage
+ *          is slow.
+ *
+ * @warning Each stage is only ever called from its own thread, so a stage's
+ *          state needs no synchronization. The value sink is called from the
+ *          thread of the last stage and the error sink under a lock, each
+ *          one call at a time. Items reach the sinks in no guaranteed order
+ *          across batches.
+ *
+ * @note Usage:
+ * ```cpp
+ * auto ingest = adt::pipeline<std::string, ParseError>()
+ *                   .then(parse_record)  // -> Result<Record, ParseError>
+ *                   .then(enrich)        // -> Enriched
+ *                   .then(validate);     // -> Result<Enriched, ParseError>
+ * ingest.run(lines, [&](Enriched &&rec) { store(rec); },
+ *            [&](ParseError err) { ++failures[err]; });
+ * ```
+ */
+template <typename In, typename E, typename... Stages> class Pipeline {
+  template <typename, typename, typename...> friend class Pipeline;
+
+  using values = typename detail::stage_values<E, In, Stages...>::type;
+  template <std::size_t I> using value_t = std::tuple_element_t<I, values>;
+  template <std::size_t I> using batch_t = std::vector<value_t<I>>;
+
+  static constexpr std::size_t stages = sizeof...(Stages);
+
+  pipeline_policy _policy;
+  std::tuple<Stages...> _stages;
+  std::unique_ptr<detail::stage_counters[]> _counters;
+
+  /**
+   * @brief The state shared by the threads of one run.
+   */
+  struct run_state {
+    std::atomic<bool> stopped{false};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    std::mutex error_mutex;
+
+    void fail() {
+      std::lock_guard<std::mutex> lock(failure_mutex);
+      if (!failure) {
+        failure = std::current_exception();
+      }
+      stopped.store(true, std::memory_order_relaxed);
+    }
+  };
+
+  Pipeline(pipeline_policy policy, std::tuple<Stages...> &&stages)
+      : _policy(policy), _stages(std::move(stages)),
+        _counters(std::make_unique<detail::stage_counters[]>(
+            sizeof...(Stages))) {}
+
+  template <typename OnError>
+  static void report_error(run_state &state, OnError &on_error, E &&error) {
+    std::lock_guard<std::mutex> lock(state.error_mutex);
+    std::invoke(on_error, std::move(error));
+  }
+
+  template <std::size_t I, typename Queues, typename OnValue,
+            typename OnError>
+  void run_stage(Queues &queues, run_state &state, OnValue &on_value,
+                 OnError &on_error) {
+    using stage_type = std::tuple_element_t<I, std::tuple<Stages...>>;
+    using output = detail::stage_output<stage_type, value_t<I>, E>;
+
+    auto &stage = std::get<I>(_stages);
+    auto &input = std::get<I>(queues);
+    batch_t<I> batch;
+    while (input.pop(batch, state.stopped)) {
+      const auto start = std::chrono::steady_clock::now();
+      batch_t<I + 1> produced;
+      produced.reserve(batch.size());
+      std::size_t failed = 0;
+      for (auto &item : batch) {
+        if constexpr (output::fallible) {
+          auto result = std::invoke(stage, std::move(item));
+          if (ADT_LIKELY(result.has_value())) {
+            produced.push_back(*std::move(result));
+          } else {
+            ++failed;
+            report_error(state, on_error,
+                         detail::moved_error(std::move(result)));
+          }
+        } else {
+          produced.push_back(std::invoke(stage, std::move(item)));
+        }
+      }
+      _counters[I].record(batch.size(), failed,
+                          std::chrono::steady_clock::now() - start);
+
+      if constexpr (I + 1 == stages) {
+        for (auto &value : produced) {
+          std::invoke(on_value, std::move(value));
+        }
+      } else if (!produced.empty() &&
+                 !std::get<I + 1>(queues).push(produced, state.stopped)) {
+        return;
+      }
+    }
+    if constexpr (I + 1 < stages) {
+      std::get<I + 1>(queues).close();
+    }
+  }
+
+  template <typename Range, typename Queue, typename OnError>
+  void feed(Range &&inputs, Queue &queue, run_state &state,
+            OnError &on_error) {
+    const std::size_t size = _policy.batch != 0 ? _policy.batch : 1;
+    batch_t<0> batch;
+    batch.reserve(size);
+    for (auto &&item : inputs) {
+      if (state.stopped.load(std::memory_order_relaxed)) {
+        return;
+      }
+      using Item = std::decay_t<decltype(item)>;
+      using Element = std::conditional_t<std::is_lvalue_reference_v<Range>,
+                                         decltype(item), Item &&>;
+      if constexpr (detail::is_result<Item>::value) {
+        // Inputs that already failed skip every stage
+        if (ADT_UNLIKELY(item.has_error())) {
+          report_error(state, on_error,
+                       detail::moved_error(Item(static_cast<Element>(item))));
+          continue;
+        }
+        batch.push_back(*static_cast<Element>(item));
+      } else {
+        batch.push_back(static_cast<Element>(item));
+      }
+      if (batch.size() == size) {
+        if (!queue.push(batch, state.stopped)) {
+          return;
+        }
+        batch.clear();
+        batch.reserve(size);
+      }
+    }
+    if (!batch.empty()) {
+      queue.push(batch, state.stopped);
+    }
+  }
+
+  template <typename Range, typename OnValue, typename OnError,
+            std::size_t... Is>
+  void run_impl(Range &&inputs, OnValue &on_value, OnError &on_error,
+                std::index_sequence<Is...>) {
+    const std::size_t capacity =
+        _policy.queue_capacity != 0 ? _policy.queue_capacity : 1;
+    std::tuple<detail::spsc_queue<batch_t<Is>>...> queues{
+        (static_cast<void>(Is), capacity)...};
+    run_state state;
+
+    std::vector<std::thread> workers;
+    workers.reserve(stages);
+    try {
+      (workers.emplace_back([&] {
+         try {
+           run_stage<Is>(queues, state, on_value, on_error);
+         } catch (...) {
+           state.fail();
+         }
+       }),
+       ...);
+    } catch (...) {
+      // A thread could not be started: stop those that were, which wait on
+      // queues nothing will feed, before their std::thread is destroyed
+      state.fail();
+      for (auto &worker : workers) {
+        worker.join();
+      }
+      throw;
+    }
+
+    try {
+      feed(std::forward<Range>(inputs), std::get<0>(queues), state,
+           on_error);
+    } catch (...) {
+      state.fail();
+    }
+    std::get<0>(queues).close();
+    for (auto &worker : workers) {
+      worker.join();
+    }
+
+    if (state.failure) {
+      std::rethrow_exception(state.failure);
+    }
+  }
+
+public:
+  using input_type = In;
+  using output_type = value_t<stages>;
+  using error_type = E;
+
+  explicit Pipeline(pipeline_policy policy = {})
+      : Pipeline(policy, std::tuple<Stages...>{}) {}
+
+  /**
+   * @brief Appends a stage, taking the value produced by the current last
+   *        stage (or an input) and returning a Result<Out, E> or an Out.
+   */
+  template <typename F>
+  [[nodiscard]] Pipeline<In, E, Stages..., std::decay_t<F>> then(F &&stage) && {
+    using next = Pipeline<In, E, Stages..., std::decay_t<F>>;
+    // Instantiated for its checks on the new stage
+    static_cast<void>(
+        sizeof(detail::stage_output_t<std::decay_t<F>, output_type, E>));
+    return next(_policy,
+                std::tuple_cat(std::move(_stages),
+                               std::make_tuple(std::forward<F>(stage))));
+  }
+
+  /**
+   * @brief Pushes every item of `inputs` (values of In, or Result<In, E>
+   *        whose errors go straight to `on_error`) through the stages, and
+   *        returns once all of them reached a sink.
+   *
+   * @details The calling thread splits `inputs` into batches; each stage
+   *          runs on a thread of its own. When a stage or a sink throws, the
+   *          run stops and the first exception is rethrown here once all
+   *          threads are joined. So is the std::system_error of a stage
+   *          thread that could not be started.
+   */
+  template <typename Range, typename OnValue, typename OnError>
+  void run(Range &&inputs, OnValue &&on_value, OnError &&on_error) {
+    static_assert(stages != 0,
+                  "❌ PIPELINE ERROR: add at least one stage with then()!");
+    static_assert(std::is_invocable_v<OnValue &, output_type &&>,
+                  "❌ PIPELINE ERROR: the value sink cannot be called with "
+                  "the value produced by the last stage!");
+    static_assert(std::is_invocable_v<OnError &, E &&>,
+                  "❌ PIPELINE ERROR: the error sink cannot be called with "
+                  "the error type of the pipeline!");
+    run_impl(std::forward<Range>(inputs), on_value, on_error,
+             std::index_sequence_for<Stages...>{});
+  }
+
+  /**
+   * @brief The counters of stage `stage` (0 is the first one added). Safe
+   *        to call while a run is in progress.
+   */
+  [[nodiscard]] stage_stats stats(std::size_t stage) const noexcept {
+    return _counters[stage].snapshot();
+  }
+
+  [[nodiscard]] static constexpr std::size_t stage_count() noexcept {
+    return stages;
+  }
+
+  void reset_stats() noexcept {
+    for (std::size_t i = 0; i < stages; ++i) {
+      _counters[i].reset();
+    }
+  }
+};
+
+/**
+ * @brief Starts a Pipeline taking items of type In, with E the error type of
+ *        every stage.
+ */
+template <typename In, typename E>
+[[nodiscard]] Pipeline<In, E> pipeline(pipeline_policy policy = {}) {
+  return Pipeline<In, E>(policy);
+}
+
+} // namespace adt
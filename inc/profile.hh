@@ -0,0 +1,246 @@
+/**
+ * @file profile.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Per-call-site hit counters of Inspect, compiled in only when
+ *        ADT_INSPECT_PROFILE is 1, and the API that reports them.
+ * @version 0.1
+ * @date 2026-01-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+#if defined(__cpp_lib_is_constant_evaluated)
+#define ADT_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__GNUC__) || defined(__clang__)
+#define ADT_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define ADT_IS_CONSTANT_EVALUATED() false
+#endif
+
+// GCC spells every lambda of a function the same in __PRETTY_FUNCTION__;
+// its demangled type names number them instead
+#if defined(__GNUC__) && !defined(__clang__) && defined(__GXX_RTTI) &&      \
+    __has_include(<cxxabi.h>)
+#define ADT_PROFILE_DEMANGLE 1
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <typeinfo>
+#else
+#define ADT_PROFILE_DEMANGLE 0
+#endif
+
+#if defined(__clang__) || defined(__GNUC__)
+#define ADT_PRETTY_FUNCTION __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+#define ADT_PRETTY_FUNCTION __FUNCSIG__
+#else
+#define ADT_PRETTY_FUNCTION __func__
+#endif
+
+namespace adt {
+
+namespace profile {
+
+/**
+ * @brief What the alternatives of a call site are: variant indices, an
+ *        optional's value (0) and empty state (1), or a Result's ok (0) and
+ *        error (1) states.
+ */
+enum class site_kind : std::uint8_t { VARIANT, OPTIONAL, RESULT };
+
+/**
+ * @brief The counters of one Inspect call site, at the time they were read.
+ */
+struct site_report {
+  /// The compiler's name of the inspected type and of the handlers
+  const char *site;
+  site_kind kind;
+  /// Hits per alternative
+  std::vector<std::uint64_t> hits;
+
+  [[nodiscard]] std::uint64_t total() const noexcept {
+    std::uint64_t sum = 0;
+    for (std::uint64_t count : hits) {
+      sum += count;
+    }
+    return sum;
+  }
+};
+
+} // namespace profile
+
+namespace detail {
+namespace profile {
+
+/**
+ * @brief A registered call site. Sites link themselves into a global list
+ *        the first time they run, with a lock-free push.
+ */
+struct site_base {
+  const char *name;
+  ::adt::profile::site_kind kind;
+  std::size_t alternatives;
+  std::atomic<std::uint64_t> *hits;
+  site_base *next = nullptr;
+};
+
+inline std::atomic<site_base *> registry{nullptr};
+
+template <std::size_t N> struct site : site_base {
+  std::atomic<std::uint64_t> counters[N] = {};
+
+  site(const char *name, ::adt::profile::site_kind kind) noexcept
+      : site_base{name, kind, N, counters} {
+    next = registry.load(std::memory_order_relaxed);
+    while (!registry.compare_exchange_weak(next, this,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+    }
+  }
+};
+
+#if ADT_PROFILE_DEMANGLE
+/**
+ * @brief "<adt> with <visitor>" from the demangled names of the two types,
+ *        or null. Allocated once per site and kept for the whole program.
+ */
+inline const char *demangled_site_name(const std::type_info &adt,
+                                       const std::type_info &visitor) noexcept {
+  int status = 0;
+  char *adt_name = abi::__cxa_demangle(adt.name(), nullptr, nullptr, &status);
+  char *visitor_name =
+      abi::__cxa_demangle(visitor.name(), nullptr, nullptr, &status);
+  char *name = nullptr;
+  if (adt_name != nullptr && visitor_name != nullptr) {
+    const std::size_t adt_size = std::strlen(adt_name);
+    const std::size_t visitor_size = std::strlen(visitor_name);
+    name = static_cast<char *>(std::malloc(adt_size + visitor_size + 7));
+    if (name != nullptr) {
+      std::memcpy(name, adt_name, adt_size);
+      std::memcpy(name + adt_size, " with ", 6);
+      std::memcpy(name + adt_size + 6, visitor_name, visitor_size + 1);
+    }
+  }
+  std::free(adt_name);
+  std::free(visitor_name);
+  return name;
+}
+#endif
+
+/**
+ * @brief Names a call site. Every lambda has a type of its own, so the
+ *        handler types tell call sites apart, and their spelling tells the
+ *        reader which site it is. Clang spells a lambda with its
+ *        file:line:column. GCC's __PRETTY_FUNCTION__ only names the
+ *        enclosing function, the same for all of its lambdas, so with RTTI
+ *        the demangled names are used, which number them in order of
+ *        appearance: `test()::{lambda(int)#2}`.
+ */
+template <typename Adt, typename Visitor> const char *site_name() noexcept {
+#if ADT_PROFILE_DEMANGLE
+  if (const char *name = demangled_site_name(typeid(Adt), typeid(Visitor))) {
+    return name;
+  }
+#endif
+  return ADT_PRETTY_FUNCTION;
+}
+
+template <::adt::profile::site_kind Kind, typename Adt, typename Visitor,
+          std::size_t N>
+site<N> &site_of() noexcept {
+  static site<N> instance(site_name<Adt, Visitor>(), Kind);
+  return instance;
+}
+
+/**
+ * @brief Counts one dispatch to `alternative` at the call site identified by
+ *        Adt and Visitor. Out-of-range indices (a valueless variant) are not
+ *        counted.
+ */
+template <::adt::profile::site_kind Kind, typename Adt, typename Visitor,
+          std::size_t N>
+void hit(std::size_t alternative) noexcept {
+  if (alternative < N) {
+    site_of<Kind, Adt, Visitor, N>().counters[alternative].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+}
+
+} // namespace profile
+} // namespace detail
+
+namespace profile {
+
+/**
+ * @brief The counters of every call site that ran at least once, most
+ *        recently registered first.
+ */
+[[nodiscard]] inline std::vector<site_report> sites() {
+  std::vector<site_report> reports;
+  for (const detail::profile::site_base *at =
+           detail::profile::registry.load(std::memory_order_acquire);
+       at != nullptr; at = at->next) {
+    site_report report{at->name, at->kind, {}};
+    report.hits.reserve(at->alternatives);
+    for (std::size_t i = 0; i < at->alternatives; ++i) {
+      report.hits.push_back(at->hits[i].load(std::memory_order_relaxed));
+    }
+    reports.push_back(std::move(report));
+  }
+  return reports;
+}
+
+/**
+ * @brief Sets every counter back to zero; the sites stay registered.
+ */
+inline void reset() noexcept {
+  for (detail::profile::site_base *at =
+           detail::profile::registry.load(std::memory_order_acquire);
+       at != nullptr; at = at->next) {
+    for (std::size_t i = 0; i < at->alternatives; ++i) {
+      at->hits[i].store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+/**
+ * @brief Writes one block per call site: its name, then the hits and share
+ *        of every alternative.
+ */
+inline void dump(std::ostream &out = std::cerr) {
+  for (const site_report &report : sites()) {
+    const std::uint64_t total = report.total();
+    out << report.site << '\n';
+    for (std::size_t i = 0; i < report.hits.size(); ++i) {
+      out << "  ";
+      if (report.kind == site_kind::OPTIONAL) {
+        out << (i == 0 ? "value" : "empty");
+      } else if (report.kind == site_kind::RESULT) {
+        out << (i == 0 ? "ok" : "error");
+      } else {
+        out << "[" << i << "]";
+      }
+      out << ": " << report.hits[i];
+      if (total != 0) {
+        out << " (" << 100.0 * static_cast<double>(report.hits[i]) /
+                           static_cast<double>(total)
+            << "%)";
+      }
+      out << '\n';
+    }
+  }
+}
+
+} // namespace profile
+
+} // namespace adt
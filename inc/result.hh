@@ -9,20 +9,87 @@
  * @copyright Copyright (c) 2026
  *
  */
+#pragma once
+
 #include <cassert>
+#include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
-#include <variant>
 
+#include <cstdint>
 #include <cstdlib>
 
+#include "hints.hh"
+#include "niche.hh"
+
+/**
+ * @brief Lets empty payloads share the address of their neighbours, so an
+ *        Ok<T> or Error<E> of an empty type adds no storage.
+ */
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(no_unique_address)
+#define ADT_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+#endif
+#ifndef ADT_NO_UNIQUE_ADDRESS
+#define ADT_NO_UNIQUE_ADDRESS
+#endif
+
+/**
+ * @brief `constexpr` on the members that need C++20 constant evaluation
+ *        rules (constexpr destructors, std::construct_at). With these, a
+ *        Result of non-trivial payloads also works at compile time; in C++17
+ *        that needs trivially destructible T and E.
+ */
+#if defined(__cpp_constexpr_dynamic_alloc) &&                                  \
+    defined(__cpp_lib_constexpr_dynamic_alloc)
+#define ADT_CONSTEXPR20 constexpr
+#else
+#define ADT_CONSTEXPR20
+#endif
+
 namespace adt {
 
+namespace detail {
+
+/**
+ * @brief Builds an X with uses-allocator construction, as std::uses_allocator
+ *        describes it: the allocator is passed as (std::allocator_arg, alloc,
+ *        args...) or as a trailing argument, and dropped when X does not use
+ *        allocators.
+ */
+template <typename X, typename Alloc, typename... Args>
+constexpr X make_using_allocator(const Alloc &alloc, Args &&...args) {
+  if constexpr (!std::uses_allocator_v<X, Alloc>) {
+    return X(std::forward<Args>(args)...);
+  } else if constexpr (std::is_constructible_v<X, std::allocator_arg_t,
+                                               const Alloc &, Args...>) {
+    return X(std::allocator_arg, alloc, std::forward<Args>(args)...);
+  } else {
+    static_assert(std::is_constructible_v<X, Args..., const Alloc &>,
+                  "Result: the payload uses the allocator but cannot be "
+                  "constructed with it.");
+    return X(std::forward<Args>(args)..., alloc);
+  }
+}
+
+} // namespace detail
+
 template <typename E> class Error {
-  E error;
+  ADT_NO_UNIQUE_ADDRESS E error;
 
 public:
-  Error(E err) : error(std::move(err)) {}
+  constexpr Error(E err) : error(std::move(err)) {}
+
+  /**
+   * @brief Builds the error from args with uses-allocator construction, e.g.
+   *        a std::pmr::string in a given memory resource.
+   */
+  template <typename Alloc, typename... Args>
+  constexpr Error(std::allocator_arg_t, const Alloc &alloc, Args &&...args)
+      : error(detail::make_using_allocator<E>(alloc,
+                                              std::forward<Args>(args)...)) {}
 
   [[nodiscard]] constexpr E &get() & { return error; }
   [[nodiscard]] constexpr const E &get() const & { return error; }
@@ -30,16 +97,542 @@ public:
 };
 
 template <typename T> class Ok {
-  T value;
+  ADT_NO_UNIQUE_ADDRESS T value;
 
 public:
-  Ok(T val) : value(std::move(val)) {}
+  constexpr Ok(T val) : value(std::move(val)) {}
+
+  /**
+   * @brief Builds the value from args with uses-allocator construction.
+   */
+  template <typename Alloc, typename... Args>
+  constexpr Ok(std::allocator_arg_t, const Alloc &alloc, Args &&...args)
+      : value(detail::make_using_allocator<T>(alloc,
+                                              std::forward<Args>(args)...)) {}
 
   [[nodiscard]] constexpr T &get() & { return value; }
   [[nodiscard]] constexpr const T &get() const & { return value; }
   [[nodiscard]] constexpr T &&get() && { return std::move(value); }
 };
 
+/**
+ * @brief The success of an operation that returns no value, for
+ *        Result<void, E>. Built with `adt::Ok()`.
+ */
+template <> class Ok<void> {
+public:
+  constexpr Ok() noexcept = default;
+};
+
+Ok() -> Ok<void>;
+
+template <typename T, typename E> class Result;
+
+namespace detail {
+
+enum class result_tag : unsigned char { ok, error };
+
+struct uninitialized_t {};
+inline constexpr uninitialized_t uninitialized{};
+
+/**
+ * @brief Placement new that is also allowed in constant expressions when
+ *        std::construct_at is available (C++20).
+ */
+template <typename X, typename... Args>
+constexpr X *construct_at(X *location, Args &&...args) {
+#if defined(__cpp_lib_constexpr_dynamic_alloc)
+  return std::construct_at(location, std::forward<Args>(args)...);
+#else
+  return ::new (static_cast<void *>(location)) X(std::forward<Args>(args)...);
+#endif
+}
+
+/**
+ * @brief Union overlaying Ok<T> and Error<E>, constructed and destroyed by
+ *        the owning layout. Stays trivially destructible when both are.
+ *        The empty `none` member is the active one before construction,
+ *        which keeps every constructor usable in constant expressions.
+ */
+template <typename T, typename E,
+          bool = std::is_trivially_destructible_v<Ok<T>> &&
+                 std::is_trivially_destructible_v<Error<E>>>
+union result_union {
+  uninitialized_t none;
+  Ok<T> ok;
+  Error<E> err;
+
+  constexpr result_union(uninitialized_t) noexcept : none() {}
+  constexpr result_union(Ok<T> &&val) : ok(std::move(val)) {}
+  constexpr result_union(Error<E> &&error) : err(std::move(error)) {}
+};
+
+template <typename T, typename E> union result_union<T, E, false> {
+  uninitialized_t none;
+  Ok<T> ok;
+  Error<E> err;
+
+  constexpr result_union(uninitialized_t) noexcept : none() {}
+  constexpr result_union(Ok<T> &&val) : ok(std::move(val)) {}
+  constexpr result_union(Error<E> &&error) : err(std::move(error)) {}
+  ADT_CONSTEXPR20 ~result_union() {}
+};
+
+/**
+ * @brief Single slot for an X that is constructed and destroyed by the
+ *        owning layout. Stays trivially destructible when X is. As in
+ *        result_union, `none` is active while the slot is empty.
+ */
+template <typename X, bool = std::is_trivially_destructible_v<X>>
+union manual_slot {
+  uninitialized_t none;
+  X value;
+
+  constexpr manual_slot(uninitialized_t) noexcept : none() {}
+  constexpr manual_slot(X &&x) : value(std::move(x)) {}
+};
+
+template <typename X> union manual_slot<X, false> {
+  uninitialized_t none;
+  X value;
+
+  constexpr manual_slot(uninitialized_t) noexcept : none() {}
+  constexpr manual_slot(X &&x) : value(std::move(x)) {}
+  ADT_CONSTEXPR20 ~manual_slot() {}
+};
+
+/**
+ * @brief Slot for an empty, trivial X that takes no storage when declared
+ *        ADT_NO_UNIQUE_ADDRESS. Used for the Ok<void> of Result<void, E>,
+ *        which has no state to construct or destroy.
+ */
+template <typename X> struct empty_slot {
+  static_assert(std::is_empty_v<X> && std::is_trivially_copyable_v<X>);
+
+  ADT_NO_UNIQUE_ADDRESS X value;
+
+  constexpr empty_slot(uninitialized_t) noexcept {}
+  constexpr empty_slot(X &&) noexcept {}
+};
+
+template <typename T>
+using ok_slot_t = std::conditional_t<std::is_void_v<T>, empty_slot<Ok<void>>,
+                                     manual_slot<Ok<T>>>;
+
+/**
+ * @brief Default layout: the active Ok<T> or Error<E> followed by a one-byte
+ *        tag.
+ */
+template <typename T, typename E> struct result_tagged_layout {
+  result_union<T, E> _data;
+  result_tag _tag;
+
+  constexpr result_tagged_layout(uninitialized_t) noexcept
+      : _data(uninitialized) {}
+  constexpr result_tagged_layout(Ok<T> &&val)
+      : _data(std::move(val)), _tag(result_tag::ok) {}
+  constexpr result_tagged_layout(Error<E> &&err)
+      : _data(std::move(err)), _tag(result_tag::error) {}
+
+  constexpr bool has_value() const noexcept { return _tag == result_tag::ok; }
+
+  constexpr Ok<T> &ok_ref() noexcept { return _data.ok; }
+  constexpr const Ok<T> &ok_ref() const noexcept { return _data.ok; }
+  constexpr Error<E> &err_ref() noexcept { return _data.err; }
+  constexpr const Error<E> &err_ref() const noexcept { return _data.err; }
+
+  template <typename Arg> constexpr void construct_ok(Arg &&arg) {
+    detail::construct_at(std::addressof(_data.ok), std::forward<Arg>(arg));
+    _tag = result_tag::ok;
+  }
+
+  template <typename Arg> constexpr void construct_err(Arg &&arg) {
+    detail::construct_at(std::addressof(_data.err), std::forward<Arg>(arg));
+    _tag = result_tag::error;
+  }
+
+  constexpr void destroy() noexcept {
+    if (has_value()) {
+      _data.ok.~Ok<T>();
+    } else {
+      _data.err.~Error<E>();
+    }
+  }
+};
+
+/**
+ * @brief Niche layout for an E with a spare value: the error slot is always
+ *        alive and holds the sentinel while the Result carries a value.
+ */
+template <typename T, typename E> struct result_error_niche_layout {
+  static_assert(std::is_trivially_copyable_v<E>,
+                "❌ NICHE ERROR: niche_traits may only be specialized for "
+                "trivially copyable types!");
+  using Niche = niche_traits<E>;
+
+  ADT_NO_UNIQUE_ADDRESS ok_slot_t<T> _ok;
+  Error<E> _err;
+
+  constexpr result_error_niche_layout(uninitialized_t) noexcept
+      : _ok(uninitialized), _err(Niche::sentinel()) {}
+  constexpr result_error_niche_layout(Ok<T> &&val)
+      : _ok(std::move(val)), _err(Niche::sentinel()) {}
+  constexpr result_error_niche_layout(Error<E> &&err)
+      : _ok(uninitialized), _err(std::move(err)) {
+    assert(!Niche::is_sentinel(_err.get()) &&
+           "Result: error value collides with the niche sentinel!");
+  }
+
+  constexpr bool has_value() const noexcept {
+    return Niche::is_sentinel(_err.get());
+  }
+
+  constexpr Ok<T> &ok_ref() noexcept { return _ok.value; }
+  constexpr const Ok<T> &ok_ref() const noexcept { return _ok.value; }
+  constexpr Error<E> &err_ref() noexcept { return _err; }
+  constexpr const Error<E> &err_ref() const noexcept { return _err; }
+
+  template <typename Arg> constexpr void construct_ok(Arg &&arg) {
+    detail::construct_at(std::addressof(_ok.value), std::forward<Arg>(arg));
+    _err = Error<E>(Niche::sentinel());
+  }
+
+  template <typename Arg> constexpr void construct_err(Arg &&arg) {
+    _err = Error<E>(std::forward<Arg>(arg));
+    assert(!Niche::is_sentinel(_err.get()) &&
+           "Result: error value collides with the niche sentinel!");
+  }
+
+  constexpr void destroy() noexcept {
+    if (has_value()) {
+      _ok.value.~Ok<T>();
+    }
+  }
+};
+
+/**
+ * @brief Niche layout for a T with a spare value: the value slot is always
+ *        alive and holds the sentinel while the Result carries an error.
+ */
+template <typename T, typename E> struct result_value_niche_layout {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "❌ NICHE ERROR: niche_traits may only be specialized for "
+                "trivially copyable types!");
+  using Niche = niche_traits<T>;
+
+  Ok<T> _ok;
+  manual_slot<Error<E>> _err;
+
+  constexpr result_value_niche_layout(uninitialized_t) noexcept
+      : _ok(Niche::sentinel()), _err(uninitialized) {}
+  constexpr result_value_niche_layout(Ok<T> &&val)
+      : _ok(std::move(val)), _err(uninitialized) {
+    assert(!Niche::is_sentinel(_ok.get()) &&
+           "Result: value collides with the niche sentinel!");
+  }
+  constexpr result_value_niche_layout(Error<E> &&err)
+      : _ok(Niche::sentinel()), _err(std::move(err)) {}
+
+  constexpr bool has_value() const noexcept {
+    return !Niche::is_sentinel(_ok.get());
+  }
+
+  constexpr Ok<T> &ok_ref() noexcept { return _ok; }
+  constexpr const Ok<T> &ok_ref() const noexcept { return _ok; }
+  constexpr Error<E> &err_ref() noexcept { return _err.value; }
+  constexpr const Error<E> &err_ref() const noexcept { return _err.value; }
+
+  template <typename Arg> constexpr void construct_ok(Arg &&arg) {
+    _ok = Ok<T>(std::forward<Arg>(arg));
+    assert(!Niche::is_sentinel(_ok.get()) &&
+           "Result: value collides with the niche sentinel!");
+  }
+
+  template <typename Arg> constexpr void construct_err(Arg &&arg) {
+    detail::construct_at(std::addressof(_err.value), std::forward<Arg>(arg));
+    _ok = Ok<T>(Niche::sentinel());
+  }
+
+  constexpr void destroy() noexcept {
+    if (!has_value()) {
+      _err.value.~Error<E>();
+    }
+  }
+};
+
+// --- Layout selection: a niche layout wins when it is not larger ---
+template <typename T, typename E,
+          bool = has_niche_v<E> && !std::is_same_v<T, E>>
+struct error_niche_fits : std::false_type {};
+template <typename T, typename E>
+struct error_niche_fits<T, E, true>
+    : std::bool_constant<sizeof(result_error_niche_layout<T, E>) <=
+                         sizeof(result_tagged_layout<T, E>)> {};
+
+template <typename T, typename E,
+          bool = has_niche_v<T> && !std::is_same_v<T, E>>
+struct value_niche_fits : std::false_type {};
+template <typename T, typename E>
+struct value_niche_fits<T, E, true>
+    : std::bool_constant<sizeof(result_value_niche_layout<T, E>) <=
+                         sizeof(result_tagged_layout<T, E>)> {};
+
+template <typename T, typename E>
+using result_layout_t = std::conditional_t<
+    error_niche_fits<T, E>::value, result_error_niche_layout<T, E>,
+    std::conditional_t<value_niche_fits<T, E>::value,
+                       result_value_niche_layout<T, E>,
+                       result_tagged_layout<T, E>>>;
+
+/**
+ * @brief Tag of the storage constructor that builds the payload with
+ *        `build(layout)`, for construction from another Result.
+ */
+struct build_t {};
+inline constexpr build_t build{};
+
+/**
+ * @brief Storage of Result in the selected layout. The specialization for
+ *        trivially destructible payloads keeps the destructor trivial, so the
+ *        whole Result stays trivially copyable.
+ */
+template <typename T, typename E,
+          bool = std::is_trivially_destructible_v<Ok<T>> &&
+                 std::is_trivially_destructible_v<Error<E>>>
+struct result_storage : result_layout_t<T, E> {
+  using result_layout_t<T, E>::result_layout_t;
+
+  template <typename Build>
+  constexpr result_storage(build_t, Build &&build)
+      : result_layout_t<T, E>(uninitialized) {
+    std::forward<Build>(build)(static_cast<result_layout_t<T, E> &>(*this));
+  }
+};
+
+template <typename T, typename E>
+struct result_storage<T, E, false> : result_layout_t<T, E> {
+  using result_layout_t<T, E>::result_layout_t;
+
+  // The payload is built inside this constructor: when building it throws,
+  // the storage was never constructed and the destructor below does not run
+  // on a payload that does not exist.
+  template <typename Build>
+  constexpr result_storage(build_t, Build &&build)
+      : result_layout_t<T, E>(uninitialized) {
+    std::forward<Build>(build)(static_cast<result_layout_t<T, E> &>(*this));
+  }
+
+  result_storage(const result_storage &) = delete;
+  result_storage &operator=(const result_storage &) = delete;
+  ADT_CONSTEXPR20 ~result_storage() { this->destroy(); }
+};
+
+/**
+ * @brief Forwards a member with the value category of its owner.
+ */
+template <typename Owner, typename Member>
+constexpr auto &&forward_like(Member &member) noexcept {
+  if constexpr (std::is_lvalue_reference_v<Owner>) {
+    return member;
+  } else {
+    return std::move(member);
+  }
+}
+
+/**
+ * @brief Copy/move operations written in terms of the raw storage, used when
+ *        the payloads are not trivially copyable.
+ */
+template <typename T, typename E>
+struct result_operations : result_storage<T, E> {
+  using result_storage<T, E>::result_storage;
+
+  template <typename Layout, typename Other>
+  static constexpr void construct_from(Layout &layout, Other &&other) {
+    if (other.has_value()) {
+      layout.construct_ok(forward_like<Other>(other.ok_ref()));
+    } else {
+      layout.construct_err(forward_like<Other>(other.err_ref()));
+    }
+  }
+
+  template <typename Other> constexpr void assign_from(Other &&other) {
+    if (this->has_value() == other.has_value()) {
+      if (this->has_value()) {
+        this->ok_ref() = forward_like<Other>(other.ok_ref());
+      } else {
+        this->err_ref() = forward_like<Other>(other.err_ref());
+      }
+      return;
+    }
+
+    // Build the new payload before tearing down the old one, so a throwing
+    // copy leaves *this untouched.
+    if (other.has_value()) {
+      Ok<T> tmp(forward_like<Other>(other.ok_ref()));
+      replace_with<true>(tmp);
+    } else {
+      Error<E> tmp(forward_like<Other>(other.err_ref()));
+      replace_with<false>(tmp);
+    }
+  }
+
+private:
+  template <bool ToValue, typename X> constexpr void construct(X &&x) {
+    if constexpr (ToValue) {
+      this->construct_ok(std::forward<X>(x));
+    } else {
+      this->construct_err(std::forward<X>(x));
+    }
+  }
+
+  // Replaces the payload by `tmp`, of the other alternative
+  template <bool ToValue, typename New>
+  constexpr void replace_with(New &tmp) {
+    if constexpr (std::is_nothrow_move_constructible_v<New> ||
+                  !ADT_HAS_EXCEPTIONS) {
+      this->destroy();
+      construct<ToValue>(std::move(tmp));
+    } else {
+      replace_guarded<ToValue>(tmp);
+    }
+  }
+
+  // Moving `tmp` in may throw: the old payload is moved aside first and put
+  // back when it does, so *this keeps its old state. Putting it back must
+  // not fail in turn, as *this would then hold nothing: that terminates.
+  template <bool ToValue, typename New> void replace_guarded(New &tmp) {
+    auto &current = [this]() -> auto & {
+      if constexpr (ToValue) {
+        return this->err_ref();
+      } else {
+        return this->ok_ref();
+      }
+    }();
+    auto backup(std::move(current));
+    this->destroy();
+#if ADT_HAS_EXCEPTIONS
+    try {
+      construct<ToValue>(std::move(tmp));
+    } catch (...) {
+      [&]() noexcept { construct<!ToValue>(std::move(backup)); }();
+      throw;
+    }
+#endif
+  }
+};
+
+template <typename T, typename E,
+          bool = std::is_trivially_copyable_v<Ok<T>> &&
+                 std::is_trivially_copyable_v<Error<E>>>
+struct result_base : result_operations<T, E> {
+  using result_operations<T, E>::result_operations;
+};
+
+template <typename T, typename E>
+struct result_base<T, E, false> : result_operations<T, E> {
+  using result_operations<T, E>::result_operations;
+
+  constexpr result_base(const result_base &other) noexcept(
+      std::is_nothrow_copy_constructible_v<Ok<T>> &&
+      std::is_nothrow_copy_constructible_v<Error<E>>)
+      : result_operations<T, E>(build, [&other](auto &layout) {
+          result_operations<T, E>::construct_from(layout, other);
+        }) {}
+
+  constexpr result_base(result_base &&other) noexcept(
+      std::is_nothrow_move_constructible_v<Ok<T>> &&
+      std::is_nothrow_move_constructible_v<Error<E>>)
+      : result_operations<T, E>(build, [&other](auto &layout) {
+          result_operations<T, E>::construct_from(layout, std::move(other));
+        }) {}
+
+  constexpr result_base &operator=(const result_base &other) noexcept(
+      std::is_nothrow_copy_constructible_v<Ok<T>> &&
+      std::is_nothrow_copy_constructible_v<Error<E>> &&
+      std::is_nothrow_copy_assignable_v<Ok<T>> &&
+      std::is_nothrow_copy_assignable_v<Error<E>>) {
+    this->assign_from(other);
+    return *this;
+  }
+
+  constexpr result_base &operator=(result_base &&other) noexcept(
+      std::is_nothrow_move_constructible_v<Ok<T>> &&
+      std::is_nothrow_move_constructible_v<Error<E>> &&
+      std::is_nothrow_move_assignable_v<Ok<T>> &&
+      std::is_nothrow_move_assignable_v<Error<E>>) {
+    this->assign_from(std::move(other));
+    return *this;
+  }
+
+  ~result_base() = default;
+};
+
+// --- Deleters of special members the payload types do not support ---
+template <bool Enable> struct enable_copy_constructor {};
+template <> struct enable_copy_constructor<false> {
+  enable_copy_constructor() = default;
+  enable_copy_constructor(const enable_copy_constructor &) = delete;
+  enable_copy_constructor(enable_copy_constructor &&) = default;
+  enable_copy_constructor &operator=(const enable_copy_constructor &) = default;
+  enable_copy_constructor &operator=(enable_copy_constructor &&) = default;
+};
+
+template <bool Enable> struct enable_move_constructor {};
+template <> struct enable_move_constructor<false> {
+  enable_move_constructor() = default;
+  enable_move_constructor(const enable_move_constructor &) = default;
+  enable_move_constructor(enable_move_constructor &&) = delete;
+  enable_move_constructor &operator=(const enable_move_constructor &) = default;
+  enable_move_constructor &operator=(enable_move_constructor &&) = default;
+};
+
+template <bool Enable> struct enable_copy_assignment {};
+template <> struct enable_copy_assignment<false> {
+  enable_copy_assignment() = default;
+  enable_copy_assignment(const enable_copy_assignment &) = default;
+  enable_copy_assignment(enable_copy_assignment &&) = default;
+  enable_copy_assignment &operator=(const enable_copy_assignment &) = delete;
+  enable_copy_assignment &operator=(enable_copy_assignment &&) = default;
+};
+
+template <bool Enable> struct enable_move_assignment {};
+template <> struct enable_move_assignment<false> {
+  enable_move_assignment() = default;
+  enable_move_assignment(const enable_move_assignment &) = default;
+  enable_move_assignment(enable_move_assignment &&) = default;
+  enable_move_assignment &operator=(const enable_move_assignment &) = default;
+  enable_move_assignment &operator=(enable_move_assignment &&) = delete;
+};
+
+// Written in terms of Ok<T> and Error<E>, which behave like T and E and
+// stay meaningful for T = void
+template <typename T, typename E>
+inline constexpr bool result_copy_constructible =
+    std::is_copy_constructible_v<Ok<T>> &&
+    std::is_copy_constructible_v<Error<E>>;
+
+template <typename T, typename E>
+inline constexpr bool result_move_constructible =
+    std::is_move_constructible_v<Ok<T>> &&
+    std::is_move_constructible_v<Error<E>>;
+
+template <typename T, typename E>
+inline constexpr bool result_copy_assignable =
+    result_copy_constructible<T, E> && std::is_copy_assignable_v<Ok<T>> &&
+    std::is_copy_assignable_v<Error<E>>;
+
+template <typename T, typename E>
+inline constexpr bool result_move_assignable =
+    result_move_constructible<T, E> && std::is_move_assignable_v<Ok<T>> &&
+    std::is_move_assignable_v<Error<E>>;
+
+template <typename X> struct is_result : std::false_type {};
+template <typename T, typename E>
+struct is_result<Result<T, E>> : std::true_type {};
+
+} // namespace detail
+
 /**
  * @brief A simple Result type representing either a value of type T or an
  *        error of type E.
@@ -49,102 +642,421 @@ public:
  *       by Rust's Result<T, E> type. It requires helper types Ok<T> and Error<E>
  *       to construct success and error states, respectively.
  *
+ * @note The payload is kept in a tagged union with a one-byte tag. When both
+ *       T and E are trivially copyable, so is the Result, which lets it be
+ *       passed in registers and copied with memcpy.
+ *
  * @warning When T and E are the same type, the user must handle Ok<T> and
  *          Error<E> explicitly to avoid ambiguity. Otherwise, accessing value()
  *          or error() will provide the underlying T or E directly.
  *
- * @tparam T The type of the value.
+ * @tparam T The type of the value, or void for operations that return none.
  * @tparam E The type of the error.
  */
-template <typename T, typename E> class Result {
-  static_assert(!std::is_void_v<T>, "Value type T cannot be void.");
+template <typename T, typename E>
+class Result
+    : private detail::result_base<T, E>,
+      private detail::enable_copy_constructor<
+          detail::result_copy_constructible<T, E>>,
+      private detail::enable_move_constructor<
+          detail::result_move_constructible<T, E>>,
+      private detail::enable_copy_assignment<
+          detail::result_copy_assignable<T, E>>,
+      private detail::enable_move_assignment<
+          detail::result_move_assignable<T, E>> {
   static_assert(!std::is_void_v<E>, "Error type E cannot be void.");
   static_assert(!std::is_reference_v<T>, "Value type T cannot be a reference.");
   static_assert(!std::is_reference_v<E>, "Error type E cannot be a reference.");
-  std::variant<Ok<T>, Error<E>> _data;
+
+  using Base = detail::result_base<T, E>;
 
 public:
-  constexpr Result(Ok<T> val) : _data(std::move(val)) {}
-  constexpr Result(Error<E> err) : _data(std::move(err)) {}
+  using value_type = T;
+  using error_type = E;
+
+  constexpr Result(Ok<T> val) : Base(std::move(val)) {}
+  constexpr Result(Error<E> err) : Base(std::move(err)) {}
+
+  /**
+   * @brief Allocator-extended constructors: the payload is rebuilt with
+   *        uses-allocator construction, so it allocates from `alloc`. They
+   *        let std::pmr containers of Results propagate their allocator.
+   */
+  template <typename Alloc>
+  constexpr Result(std::allocator_arg_t, const Alloc &alloc, Ok<T> val)
+      : Base(ok_with(alloc, std::move(val))) {}
+  template <typename Alloc>
+  constexpr Result(std::allocator_arg_t, const Alloc &alloc, Error<E> err)
+      : Base(error_with(alloc, std::move(err))) {}
+  template <typename Alloc>
+  constexpr Result(std::allocator_arg_t, const Alloc &alloc,
+                   const Result &other)
+      : Base(detail::build, [&](auto &layout) {
+          construct_with(layout, alloc, other);
+        }) {}
+  template <typename Alloc>
+  constexpr Result(std::allocator_arg_t, const Alloc &alloc, Result &&other)
+      : Base(detail::build, [&](auto &layout) {
+          construct_with(layout, alloc, std::move(other));
+        }) {}
 
   [[nodiscard]]
   constexpr bool has_value() const noexcept {
-    return std::holds_alternative<Ok<T>>(_data);
+    return Base::has_value();
   }
   [[nodiscard]]
   constexpr bool has_error() const noexcept {
-    return std::holds_alternative<Error<E>>(_data);
+    return !Base::has_value();
   }
 
   [[nodiscard]] constexpr decltype(auto) value() & {
     ensure_value();
-    if constexpr (std::is_same_v<T, E>) {
-      return std::get<Ok<T>>(_data);
-    } else {
-      return std::get<Ok<T>>(_data).get();
-    }
+    return unsafe_value();
   }
 
   [[nodiscard]] constexpr decltype(auto) value() const & {
     ensure_value();
-    if constexpr (std::is_same_v<T, E>) {
-      return std::get<Ok<T>>(_data);
-    } else {
-      return std::get<Ok<T>>(_data).get();
-    }
+    return unsafe_value();
   }
 
   [[nodiscard]] constexpr decltype(auto) value() && {
     ensure_value();
-    if constexpr (std::is_same_v<T, E>) {
-      return std::get<Ok<T>>(std::move(_data));
-    } else {
-      return std::get<Ok<T>>(std::move(_data)).get();
-    }
+    return std::move(*this).unsafe_value();
   }
 
   [[nodiscard]] constexpr decltype(auto) error() & {
     ensure_error();
+    return unsafe_error();
+  }
+
+  [[nodiscard]] constexpr decltype(auto) error() const & {
+    ensure_error();
+    return unsafe_error();
+  }
+
+  [[nodiscard]] constexpr decltype(auto) error() && {
+    ensure_error();
+    return std::move(*this).unsafe_error();
+  }
+
+  /**
+   * @brief Unchecked counterparts of value() and error(), returning the same
+   *        types. The state is verified with an assert in debug builds only.
+   *
+   * @warning Calling them on the wrong state is undefined behavior. Use them
+   *          right after has_value() was tested, as Inspect does.
+   */
+  [[nodiscard]] constexpr decltype(auto) unsafe_value() & noexcept {
+    assert(has_value() && "Result: unsafe_value() called on error state!");
+    if constexpr (std::is_same_v<T, E>) {
+      return (this->ok_ref());
+    } else if constexpr (!std::is_void_v<T>) {
+      return this->ok_ref().get();
+    }
+  }
+
+  [[nodiscard]] constexpr decltype(auto) unsafe_value() const & noexcept {
+    assert(has_value() && "Result: unsafe_value() called on error state!");
+    if constexpr (std::is_same_v<T, E>) {
+      return (this->ok_ref());
+    } else if constexpr (!std::is_void_v<T>) {
+      return this->ok_ref().get();
+    }
+  }
+
+  [[nodiscard]] constexpr decltype(auto) unsafe_value() && noexcept {
+    assert(has_value() && "Result: unsafe_value() called on error state!");
+    if constexpr (std::is_same_v<T, E>) {
+      return std::move(this->ok_ref());
+    } else if constexpr (!std::is_void_v<T>) {
+      return std::move(this->ok_ref()).get();
+    }
+  }
+
+  [[nodiscard]] constexpr decltype(auto) unsafe_error() & noexcept {
+    assert(has_error() && "Result: unsafe_error() called on success state!");
     if constexpr (std::is_same_v<T, E>) {
-      return std::get<Error<E>>(_data);
+      return (this->err_ref());
     } else {
-      return std::get<Error<E>>(_data).get();
+      return this->err_ref().get();
     }
   }
 
-  [[nodiscard]] constexpr decltype(auto) error() const & {
-    ensure_error();
+  [[nodiscard]] constexpr decltype(auto) unsafe_error() const & noexcept {
+    assert(has_error() && "Result: unsafe_error() called on success state!");
     if constexpr (std::is_same_v<T, E>) {
-      return std::get<Error<E>>(_data);
+      return (this->err_ref());
     } else {
-      return std::get<Error<E>>(_data).get();
+      return this->err_ref().get();
     }
   }
 
-  [[nodiscard]] constexpr decltype(auto) error() && {
-    ensure_error();
+  [[nodiscard]] constexpr decltype(auto) unsafe_error() && noexcept {
+    assert(has_error() && "Result: unsafe_error() called on success state!");
     if constexpr (std::is_same_v<T, E>) {
-      return std::get<Error<E>>(std::move(_data));
+      return std::move(this->err_ref());
     } else {
-      return std::get<Error<E>>(std::move(_data)).get();
+      return std::move(this->err_ref()).get();
+    }
+  }
+
+  /**
+   * @brief Unchecked access to the bare value, as in std::expected. Unlike
+   *        value(), these never return Ok<T>, also when T and E are the same.
+   *        Not available for Result<void, E>.
+   */
+  template <typename U = T, std::enable_if_t<!std::is_void_v<U>, int> = 0>
+  [[nodiscard]] constexpr U &operator*() & noexcept {
+    assert(has_value() && "Result: operator* called on error state!");
+    return this->ok_ref().get();
+  }
+  template <typename U = T, std::enable_if_t<!std::is_void_v<U>, int> = 0>
+  [[nodiscard]] constexpr const U &operator*() const & noexcept {
+    assert(has_value() && "Result: operator* called on error state!");
+    return this->ok_ref().get();
+  }
+  template <typename U = T, std::enable_if_t<!std::is_void_v<U>, int> = 0>
+  [[nodiscard]] constexpr U &&operator*() && noexcept {
+    assert(has_value() && "Result: operator* called on error state!");
+    return std::move(this->ok_ref()).get();
+  }
+
+  template <typename U = T, std::enable_if_t<!std::is_void_v<U>, int> = 0>
+  [[nodiscard]] constexpr U *operator->() noexcept {
+    assert(has_value() && "Result: operator-> called on error state!");
+    return std::addressof(this->ok_ref().get());
+  }
+  template <typename U = T, std::enable_if_t<!std::is_void_v<U>, int> = 0>
+  [[nodiscard]] constexpr const U *operator->() const noexcept {
+    assert(has_value() && "Result: operator-> called on error state!");
+    return std::addressof(this->ok_ref().get());
+  }
+
+  /**
+   * @brief Transforms the value with `f`, propagating the error untouched.
+   *        On an rvalue Result the value and the error are moved, never
+   *        copied. For Result<void, E>, `f` takes no argument.
+   *
+   * @return Result<U, E>, where U is the type returned by `f` (possibly
+   *         void).
+   */
+  template <typename F> constexpr auto map(F &&f) & {
+    return map_impl(*this, std::forward<F>(f));
+  }
+  template <typename F> constexpr auto map(F &&f) const & {
+    return map_impl(*this, std::forward<F>(f));
+  }
+  template <typename F> constexpr auto map(F &&f) && {
+    return map_impl(std::move(*this), std::forward<F>(f));
+  }
+
+  /**
+   * @brief Chains a fallible step: `f` receives the value (nothing for
+   *        Result<void, E>) and returns a Result<U, E>. The error is
+   *        propagated without calling `f`.
+   */
+  template <typename F> constexpr auto and_then(F &&f) & {
+    return and_then_impl(*this, std::forward<F>(f));
+  }
+  template <typename F> constexpr auto and_then(F &&f) const & {
+    return and_then_impl(*this, std::forward<F>(f));
+  }
+  template <typename F> constexpr auto and_then(F &&f) && {
+    return and_then_impl(std::move(*this), std::forward<F>(f));
+  }
+
+  /**
+   * @brief Recovers from an error: `f` receives the error and returns a
+   *        Result<T, G>. The value is propagated without calling `f`.
+   */
+  template <typename F> constexpr auto or_else(F &&f) & {
+    return or_else_impl(*this, std::forward<F>(f));
+  }
+  template <typename F> constexpr auto or_else(F &&f) const & {
+    return or_else_impl(*this, std::forward<F>(f));
+  }
+  template <typename F> constexpr auto or_else(F &&f) && {
+    return or_else_impl(std::move(*this), std::forward<F>(f));
+  }
+
+  /**
+   * @brief Transforms the error with `f`, propagating the value untouched.
+   *
+   * @return Result<T, G>, where G is the type returned by `f`.
+   */
+  template <typename F> constexpr auto transform_error(F &&f) & {
+    return transform_error_impl(*this, std::forward<F>(f));
+  }
+  template <typename F> constexpr auto transform_error(F &&f) const & {
+    return transform_error_impl(*this, std::forward<F>(f));
+  }
+  template <typename F> constexpr auto transform_error(F &&f) && {
+    return transform_error_impl(std::move(*this), std::forward<F>(f));
+  }
+
+  /**
+   * @brief Returns the value, or `fallback` converted to T on error.
+   */
+  template <typename U>
+  [[nodiscard]] constexpr T value_or(U &&fallback) const & {
+    static_assert(!std::is_void_v<T>,
+                  "Result::value_or: Result<void, E> has no value.");
+    if (has_value()) {
+      return this->ok_ref().get();
+    }
+    return static_cast<T>(std::forward<U>(fallback));
+  }
+  template <typename U>
+  [[nodiscard]] constexpr T value_or(U &&fallback) && {
+    static_assert(!std::is_void_v<T>,
+                  "Result::value_or: Result<void, E> has no value.");
+    if (has_value()) {
+      return std::move(this->ok_ref()).get();
     }
+    return static_cast<T>(std::forward<U>(fallback));
   }
 
 private:
-  constexpr void ensure_value() const {
-    if (!has_value()) {
-      assert(false && "Result: Attempt to access value on error state!");
+  // The combinators always pass the bare T / E, also when T and E are the
+  // same type, and forward them with the value category of the Result.
+  template <typename Self>
+  static constexpr decltype(auto) value_of(Self &&self) {
+    return detail::forward_like<Self>(self.ok_ref().get());
+  }
+  template <typename Self>
+  static constexpr decltype(auto) error_of(Self &&self) {
+    return detail::forward_like<Self>(self.err_ref().get());
+  }
+
+  template <typename Alloc, typename Val>
+  static constexpr Ok<T> ok_with(const Alloc &alloc, Val &&val) {
+    if constexpr (std::is_void_v<T>) {
+      return Ok<void>();
+    } else {
+      return Ok<T>(std::allocator_arg, alloc, std::forward<Val>(val).get());
+    }
+  }
+  template <typename Alloc, typename Err>
+  static constexpr Error<E> error_with(const Alloc &alloc, Err &&err) {
+    return Error<E>(std::allocator_arg, alloc, std::forward<Err>(err).get());
+  }
+
+  template <typename Layout, typename Alloc, typename Other>
+  static constexpr void construct_with(Layout &layout, const Alloc &alloc,
+                                       Other &&other) {
+    if (other.has_value()) {
+      layout.construct_ok(
+          ok_with(alloc, detail::forward_like<Other>(other.ok_ref())));
+    } else {
+      layout.construct_err(
+          error_with(alloc, detail::forward_like<Other>(other.err_ref())));
+    }
+  }
+
+  // Calls `f` with the value, or with nothing for Result<void, E>
+  template <typename Self, typename F>
+  static constexpr decltype(auto) apply_value(Self &&self, F &&f) {
+    if constexpr (std::is_void_v<T>) {
+      return std::forward<F>(f)();
+    } else {
+      return std::forward<F>(f)(value_of(std::forward<Self>(self)));
+    }
+  }
 
-      std::abort();
+  template <typename Self, typename F>
+  static constexpr auto map_impl(Self &&self, F &&f) {
+    using U = std::decay_t<decltype(apply_value(std::forward<Self>(self),
+                                                std::forward<F>(f)))>;
+    if (self.has_value()) {
+      if constexpr (std::is_void_v<U>) {
+        apply_value(std::forward<Self>(self), std::forward<F>(f));
+        return Result<U, E>(Ok<void>());
+      } else {
+        return Result<U, E>(
+            Ok<U>(apply_value(std::forward<Self>(self), std::forward<F>(f))));
+      }
+    }
+    return Result<U, E>(Error<E>(error_of(std::forward<Self>(self))));
+  }
+
+  template <typename Self, typename F>
+  static constexpr auto and_then_impl(Self &&self, F &&f) {
+    using R = std::decay_t<decltype(apply_value(std::forward<Self>(self),
+                                                std::forward<F>(f)))>;
+    static_assert(detail::is_result<R>::value,
+                  "Result::and_then: the function must return a Result.");
+    static_assert(std::is_same_v<typename R::error_type, E>,
+                  "Result::and_then: the function must keep the error type.");
+    if (self.has_value()) {
+      return R(apply_value(std::forward<Self>(self), std::forward<F>(f)));
+    }
+    return R(Error<E>(error_of(std::forward<Self>(self))));
+  }
+
+  template <typename Self, typename F>
+  static constexpr auto or_else_impl(Self &&self, F &&f) {
+    using R = std::decay_t<decltype(std::forward<F>(f)(
+        error_of(std::forward<Self>(self))))>;
+    static_assert(detail::is_result<R>::value,
+                  "Result::or_else: the function must return a Result.");
+    static_assert(std::is_same_v<typename R::value_type, T>,
+                  "Result::or_else: the function must keep the value type.");
+    if (self.has_value()) {
+      return R(Ok<T>(detail::forward_like<Self>(self.ok_ref())));
+    }
+    return R(std::forward<F>(f)(error_of(std::forward<Self>(self))));
+  }
+
+  template <typename Self, typename F>
+  static constexpr auto transform_error_impl(Self &&self, F &&f) {
+    using G = std::decay_t<decltype(std::forward<F>(f)(
+        error_of(std::forward<Self>(self))))>;
+    static_assert(!std::is_void_v<G>,
+                  "Result::transform_error: the function must return a value.");
+    if (self.has_value()) {
+      return Result<T, G>(Ok<T>(detail::forward_like<Self>(self.ok_ref())));
+    }
+    return Result<T, G>(
+        Error<G>(std::forward<F>(f)(error_of(std::forward<Self>(self)))));
+  }
+
+  constexpr void ensure_value() const {
+    if (ADT_UNLIKELY(!has_value())) {
+      detail::abort_with("Result: Attempt to access value on error state!");
     }
   }
 
   constexpr void ensure_error() const {
-    if (!has_error()) {
-      assert(false && "Result: Attempt to access error on success state!");
-      std::abort();
+    if (ADT_UNLIKELY(!has_error())) {
+      detail::abort_with("Result: Attempt to access error on success state!");
     }
   }
 };
 
-} // namespace adt
\ No newline at end of file
+// --- Layout guarantees: a one-byte tag and no hidden overhead ---
+static_assert(sizeof(Result<std::uint8_t, std::uint8_t>) == 2);
+static_assert(sizeof(Result<std::uint16_t, std::uint8_t>) == 4);
+static_assert(sizeof(Result<std::uint32_t, std::uint32_t>) == 8);
+static_assert(sizeof(Result<std::uint32_t, std::uint8_t>) == 8);
+static_assert(sizeof(Result<std::uint64_t, std::uint32_t>) == 16);
+static_assert(sizeof(Result<void *, std::uint32_t>) == 2 * sizeof(void *));
+static_assert(
+    std::is_trivially_copyable_v<Result<std::uint32_t, std::uint32_t>>);
+static_assert(std::is_trivially_copyable_v<Result<void *, std::uint32_t>>);
+static_assert(
+    std::is_trivially_destructible_v<Result<std::uint64_t, std::uint32_t>>);
+static_assert(std::is_empty_v<Ok<void>>);
+static_assert(sizeof(Result<void, std::uint32_t>) == 8);
+static_assert(std::is_trivially_copyable_v<Result<void, std::uint32_t>>);
+
+} // namespace adt
+
+/**
+ * @brief A Result uses an allocator when its value or its error does, so
+ *        uses-allocator construction (std::pmr containers, scoped
+ *        allocators) reaches the payloads.
+ */
+template <typename T, typename E, typename Alloc>
+struct std::uses_allocator<adt::Result<T, E>, Alloc>
+    : std::bool_constant<std::uses_allocator_v<T, Alloc> ||
+                         std::uses_allocator_v<E, Alloc>> {};
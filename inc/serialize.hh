@@ -0,0 +1,546 @@
+/**
+ * @file serialize.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides a compact wire format for std::variant, optional and
+ *        Expected/Result values of trivially copyable payloads: serialize
+ *        into a caller-supplied buffer, deserialize from bytes, and WireView,
+ *        which Inspects the bytes in place without building the value.
+ * @version 0.1
+ * @date 2026-01-11
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+#include "inspect.hh"
+#include "niche.hh"
+#include "optional.hh"
+#include "result.hh"
+
+namespace adt {
+
+/**
+ * @brief Why bytes could not be written or read.
+ */
+enum class WireError : std::uint8_t {
+  NONE,
+  BUFFER_TOO_SMALL, // serialize: the buffer cannot hold the message
+  TRUNCATED,        // read: the bytes end inside the message
+  BAD_TAG,          // read: the tag names no alternative or state
+  BAD_PAYLOAD,      // read: the payload is the niche sentinel of its type
+};
+
+/**
+ * @brief Whether every byte of a T belongs to its value, so copying it to
+ *        the wire cannot leak the uninitialized contents of padding. True for
+ *        types with unique object representations and for float and double;
+ *        specialize it for a struct without padding that holds members of
+ *        other types, e.g. a double.
+ */
+template <typename T>
+struct is_padding_free
+    : std::bool_constant<std::has_unique_object_representations_v<T> ||
+                         std::is_same_v<T, float> ||
+                         std::is_same_v<T, double>> {};
+
+template <>
+struct niche_traits<WireError> : sentinel_niche<WireError, WireError::NONE> {};
+
+namespace detail {
+
+/**
+ * @brief Bytes taken by a payload on the wire: none for void and for empty
+ *        types, which are rebuilt by value-initialization.
+ */
+template <typename T, typename = void>
+struct wire_size : std::integral_constant<std::size_t, sizeof(T)> {};
+
+template <> struct wire_size<void> : std::integral_constant<std::size_t, 0> {};
+
+template <typename T>
+struct wire_size<T, std::enable_if_t<std::is_empty_v<T>>>
+    : std::integral_constant<std::size_t, 0> {};
+
+template <typename T>
+inline constexpr bool wire_payload_v =
+    std::is_void_v<T> || (std::is_trivially_copyable_v<T> &&
+                          std::is_default_constructible_v<T>);
+
+/**
+ * @brief Copies a payload as it is in memory. Only padding-free payloads are
+ *        accepted, as every byte of the object reaches the wire.
+ */
+template <typename T> void store_payload(std::byte *out, const T &value) {
+  if constexpr (wire_size<T>::value != 0) {
+    std::memcpy(out, std::addressof(value), sizeof(T));
+  }
+}
+
+/**
+ * @brief Reads a payload with memcpy, which is valid at any alignment (e.g.
+ *        inside an mmap'd file) and compiles to plain loads.
+ */
+template <typename T> T load_payload(const std::byte *in) {
+  T value{};
+  if constexpr (wire_size<T>::value != 0) {
+    std::memcpy(std::addressof(value), in, sizeof(T));
+  }
+  return value;
+}
+
+template <typename T> constexpr bool is_niche_sentinel(const T &value) {
+  if constexpr (has_niche_v<T>) {
+    return niche_traits<T>::is_sentinel(value);
+  } else {
+    return false;
+  }
+}
+
+template <std::size_t... Sizes> constexpr std::size_t max_of() {
+  std::size_t largest = 0;
+  ((largest = Sizes > largest ? Sizes : largest), ...);
+  return largest;
+}
+
+/**
+ * @brief The payload types of the tags of a format, in tag order; void for a
+ *        tag carrying no payload.
+ */
+template <typename... Ts> struct payload_list {};
+
+template <std::size_t I, typename List> struct payload_at;
+
+template <typename T, typename... Ts>
+struct payload_at<0, payload_list<T, Ts...>> {
+  using type = T;
+};
+
+template <std::size_t I, typename T, typename... Ts>
+struct payload_at<I, payload_list<T, Ts...>>
+    : payload_at<I - 1, payload_list<Ts...>> {};
+
+template <std::size_t I, typename List>
+using payload_at_t = typename payload_at<I, List>::type;
+
+/**
+ * @brief Calls `f(index_constant<Tag>{}, payload...)` for a tag in range,
+ *        passing the payload of that tag read from `in` (nothing for void).
+ */
+template <typename Payload, std::size_t Tag, typename F>
+decltype(auto) decode_payload(const std::byte *in, F &&f) {
+  if constexpr (std::is_void_v<Payload>) {
+    return std::forward<F>(f)(index_constant<Tag>{});
+  } else {
+    const Payload value = load_payload<Payload>(in);
+    return std::forward<F>(f)(index_constant<Tag>{}, value);
+  }
+}
+
+template <typename T> struct wire_format_check {
+  static_assert(wire_payload_v<T>,
+                "❌ SERIALIZE ERROR: the wire format only holds payloads "
+                "that are trivially copyable and default constructible!");
+  static_assert(wire_size<T>::value == 0 || is_padding_free<T>::value,
+                "❌ SERIALIZE ERROR: the payload may have padding, whose "
+                "uninitialized bytes would be written out; remove it and "
+                "specialize adt::is_padding_free for the type!");
+  static constexpr bool value = true;
+};
+
+/**
+ * @brief The layout of a variant: its index in one byte, then the bytes of
+ *        the active alternative.
+ */
+template <typename Variant> struct variant_wire;
+
+template <typename... Ts> struct variant_wire<std::variant<Ts...>> {
+  static_assert((wire_format_check<Ts>::value && ...));
+  static_assert(sizeof...(Ts) <= 255,
+                "❌ SERIALIZE ERROR: a variant on the wire has at most 255 "
+                "alternatives!");
+
+  using Adt = std::variant<Ts...>;
+  using Payloads = payload_list<Ts...>;
+
+  static constexpr std::size_t tags = sizeof...(Ts);
+  static constexpr std::size_t payload_sizes[] = {wire_size<Ts>::value...};
+  static constexpr std::size_t max_payload =
+      max_of<wire_size<Ts>::value...>();
+  static constexpr bool any_niche_payload = false;
+
+  static std::size_t tag_of(const Adt &adt) noexcept { return adt.index(); }
+
+  static void write_payload(const Adt &adt, std::byte *out) {
+    detail::visit([out](const auto &alt) { store_payload(out, alt); }, adt);
+  }
+
+  template <std::size_t Tag, typename... Payload>
+  static Adt make(const Payload &...payload) {
+    return Adt(std::in_place_index<Tag>, payload...);
+  }
+};
+
+/**
+ * @brief The layout of an optional: 0 when empty, 1 followed by the value.
+ */
+template <typename Opt> struct optional_wire {
+  using T = remove_cvref_t<decltype(*std::declval<const Opt &>())>;
+  static_assert(wire_format_check<T>::value);
+
+  using Adt = Opt;
+  using Payloads = payload_list<void, T>;
+
+  static constexpr std::size_t tags = 2;
+  static constexpr std::size_t payload_sizes[] = {0, wire_size<T>::value};
+  static constexpr std::size_t max_payload = wire_size<T>::value;
+  static constexpr bool niche_payloads[] = {
+      false, has_niche_v<T> && std::is_same_v<Adt, Optional<T>>};
+  static constexpr bool any_niche_payload = niche_payloads[1];
+
+  static std::size_t tag_of(const Adt &adt) noexcept {
+    return adt.has_value() ? 1 : 0;
+  }
+
+  static void write_payload(const Adt &adt, std::byte *out) {
+    if (adt.has_value()) {
+      store_payload(out, *adt);
+    }
+  }
+
+  template <std::size_t Tag, typename... Payload>
+  static Adt make(const Payload &...payload) {
+    if constexpr (Tag == 0) {
+      return Adt();
+    } else {
+      return Adt(payload...);
+    }
+  }
+};
+
+/**
+ * @brief Which payload of an adt::Result its layout keeps the sentinel of
+ *        the other state in. Bytes holding that sentinel under the tag of
+ *        the payload would read back as the other state.
+ */
+template <typename Exp> struct result_niche_side {
+  static constexpr bool value = false;
+  static constexpr bool error = false;
+};
+
+template <typename T, typename E> struct result_niche_side<Result<T, E>> {
+  static constexpr bool value = std::is_same_v<result_layout_t<T, E>,
+                                               result_value_niche_layout<T, E>>;
+  static constexpr bool error = std::is_same_v<result_layout_t<T, E>,
+                                               result_error_niche_layout<T, E>>;
+};
+
+/**
+ * @brief The layout of an Expected/Result: 0 followed by the value (nothing
+ *        for void), or 1 followed by the error.
+ */
+template <typename Exp> struct expected_wire {
+  using T = typename Exp::value_type;
+  using E = typename Exp::error_type;
+  static_assert(wire_format_check<T>::value && wire_format_check<E>::value);
+
+  using Adt = Exp;
+  using Payloads = payload_list<T, E>;
+
+  static constexpr std::size_t tags = 2;
+  static constexpr std::size_t payload_sizes[] = {wire_size<T>::value,
+                                                  wire_size<E>::value};
+  static constexpr std::size_t max_payload =
+      max_of<wire_size<T>::value, wire_size<E>::value>();
+  static constexpr bool niche_payloads[] = {
+      result_niche_side<Adt>::value, result_niche_side<Adt>::error};
+  static constexpr bool any_niche_payload =
+      niche_payloads[0] || niche_payloads[1];
+
+  static std::size_t tag_of(const Adt &adt) noexcept {
+    return adt.has_value() ? 0 : 1;
+  }
+
+  static void write_payload(const Adt &adt, std::byte *out) {
+    if (!adt.has_value()) {
+      store_payload(out, expected_error(adt));
+    } else if constexpr (!std::is_void_v<T>) {
+      store_payload(out, expected_value(adt));
+    }
+  }
+
+  template <std::size_t Tag, typename... Payload>
+  static Adt make(const Payload &...payload) {
+    static_assert(is_result<Adt>::value,
+                  "❌ SERIALIZE ERROR: deserialize builds adt::Result; read "
+                  "other Expected types through a WireView!");
+    if constexpr (Tag == 0) {
+      return Adt(Ok<T>(payload...));
+    } else {
+      return Adt(Error<E>(payload...));
+    }
+  }
+};
+
+template <typename Adt, typename Raw = remove_cvref_t<Adt>>
+using wire_format_t = std::conditional_t<
+    traits::is_variant<Raw>::value, variant_wire<Raw>,
+    std::conditional_t<traits::is_optional<Raw>::value, optional_wire<Raw>,
+                       expected_wire<Raw>>>;
+
+/**
+ * @brief Calls `f(index_constant<Tag>{}, payload...)` for the message at
+ *        `data`, whose bytes must have passed check_message.
+ */
+template <typename Format, typename F>
+decltype(auto) decode_message(const std::byte *data, F &&f) {
+  return with_index<Format::tags>(
+      static_cast<std::size_t>(data[0]), [&](auto tag) -> decltype(auto) {
+        using Payload =
+            payload_at_t<decltype(tag)::value, typename Format::Payloads>;
+        return decode_payload<Payload, decltype(tag)::value>(data + 1, f);
+      });
+}
+
+/**
+ * @brief Validates a message: a known tag, all of its payload present, and
+ *        no niche sentinel in a payload stored in a niche (see
+ *        niche_payloads), which the value would not be able to hold.
+ */
+template <typename Format>
+WireError check_message(const std::byte *data, std::size_t size) noexcept {
+  if (size == 0) {
+    return WireError::TRUNCATED;
+  }
+  const auto tag = static_cast<std::size_t>(data[0]);
+  if (tag >= Format::tags) {
+    return WireError::BAD_TAG;
+  }
+  if (size < 1 + Format::payload_sizes[tag]) {
+    return WireError::TRUNCATED;
+  }
+  if constexpr (Format::any_niche_payload) {
+    if (Format::niche_payloads[tag] &&
+        decode_message<Format>(data, [](auto, const auto &...payload) {
+          return (is_niche_sentinel(payload) || ...);
+        })) {
+      return WireError::BAD_PAYLOAD;
+    }
+  }
+  return WireError::NONE;
+}
+
+} // namespace detail
+
+/**
+ * @brief The largest number of bytes `serialize` writes for an Adt, e.g. to
+ *        size a fixed buffer.
+ */
+template <typename Adt>
+inline constexpr std::size_t max_serialized_size_v =
+    1 + detail::wire_format_t<Adt>::max_payload;
+
+/**
+ * @brief The number of bytes `serialize` writes for this value.
+ */
+template <typename Adt>
+[[nodiscard]] std::size_t serialized_size(const Adt &adt) noexcept {
+  using Format = detail::wire_format_t<Adt>;
+  return 1 + Format::payload_sizes[Format::tag_of(adt)];
+}
+
+/**
+ * @brief Writes a variant, optional or Expected/Result as one tag byte
+ *        followed by the bytes of its active payload.
+ *
+ * @return The number of bytes written, or WireError::BUFFER_TOO_SMALL when
+ *         `capacity` is below serialized_size(adt); nothing is written then.
+ *
+ * @note The payloads are copied as they are in memory, so both ends must
+ *       agree on their layout and byte order (same ABI), as for IPC or files
+ *       read back on the same platform.
+ * ```cpp
+ * std::array<std::byte, adt::max_serialized_size_v<Event>> buffer;
+ * adt::Inspect(adt::serialize(event, buffer.data(), buffer.size()),
+ *              [&](std::size_t size) { send(buffer.data(), size); },
+ *              [](adt::WireError) { ... });
+ * ```
+ */
+template <typename Adt>
+[[nodiscard]] Result<std::size_t, WireError>
+serialize(const Adt &adt, std::byte *buffer, std::size_t capacity) noexcept {
+  using Format = detail::wire_format_t<Adt>;
+  const std::size_t tag = Format::tag_of(adt);
+  const std::size_t size = 1 + Format::payload_sizes[tag];
+  if (size > capacity) {
+    return Error(WireError::BUFFER_TOO_SMALL);
+  }
+  buffer[0] = static_cast<std::byte>(tag);
+  Format::write_payload(adt, buffer + 1);
+  return Ok(size);
+}
+
+/**
+ * @brief Reads back a value written by serialize. Bytes after the message
+ *        are ignored; serialized_size of the result tells where it ended.
+ *
+ * @note Expected types are read back as adt::Result only. Read any of them
+ *       without copying through WireView.
+ */
+template <typename Adt>
+[[nodiscard]] Result<Adt, WireError> deserialize(const std::byte *data,
+                                                 std::size_t size) noexcept {
+  using Format = detail::wire_format_t<Adt>;
+  if (const WireError error = detail::check_message<Format>(data, size);
+      error != WireError::NONE) {
+    return Error(error);
+  }
+  return detail::decode_message<Format>(
+      data, [](auto tag, const auto &...payload) {
+        return Result<Adt, WireError>(Ok<Adt>(
+            Format::template make<decltype(tag)::value>(payload...)));
+      });
+}
+
+/**
+ * @brief A serialized Adt read in place: a validated pointer into the
+ *        bytes, which Inspect decodes only the active payload of into the
+ *        handler's argument, without building the variant or Result.
+ *
+ * @warning The view does not own the bytes, which must outlive it. Handlers
+ *          receive the payload as a const reference to a copy on the stack,
+ *          so they must not keep it.
+ *
+ * @note Walking a stream of events from an mmap'd file:
+ * ```cpp
+ * for (std::size_t at = 0; at < file.size();) {
+ *   auto view = adt::view_as<Event>(file.data() + at, file.size() - at);
+ *   if (!view.has_value()) break;
+ *   adt::Inspect(*view, [](const Tick &tick) { ... },
+ *                [](const Trade &trade) { ... });
+ *   at += view->size();
+ * }
+ * ```
+ */
+template <typename Adt> class WireView {
+  using Format = detail::wire_format_t<Adt>;
+
+  const std::byte *_data;
+
+  explicit constexpr WireView(const std::byte *data) noexcept : _data(data) {}
+
+  template <typename A>
+  friend Result<WireView<A>, WireError> view_as(const std::byte *,
+                                                std::size_t) noexcept;
+
+public:
+  using adt_type = Adt;
+
+  /**
+   * @brief The tag of the message: the variant index, or for an optional
+   *        and an Expected/Result respectively engaged and in error when 1.
+   */
+  [[nodiscard]] constexpr std::size_t tag() const noexcept {
+    return static_cast<std::size_t>(_data[0]);
+  }
+
+  [[nodiscard]] constexpr const std::byte *data() const noexcept {
+    return _data;
+  }
+
+  /**
+   * @brief The number of bytes of the message, tag included.
+   */
+  [[nodiscard]] constexpr std::size_t size() const noexcept {
+    return 1 + Format::payload_sizes[tag()];
+  }
+
+  /**
+   * @brief Builds the value the bytes hold, as deserialize would.
+   */
+  [[nodiscard]] Adt materialize() const {
+    return detail::decode_message<Format>(
+        _data, [](auto tag, const auto &...payload) {
+          return Format::template make<decltype(tag)::value>(payload...);
+        });
+  }
+
+  template <typename F> decltype(auto) decode(F &&f) const {
+    return detail::decode_message<Format>(_data, std::forward<F>(f));
+  }
+};
+
+/**
+ * @brief Checks that the bytes start with a complete message of type Adt and
+ *        returns a view of it, or the reason they do not.
+ */
+template <typename Adt>
+[[nodiscard]] Result<WireView<Adt>, WireError>
+view_as(const std::byte *data, std::size_t size) noexcept {
+  if (const WireError error =
+          detail::check_message<detail::wire_format_t<Adt>>(data, size);
+      error != WireError::NONE) {
+    return Error(error);
+  }
+  return Ok(WireView<Adt>(data));
+}
+
+#if defined(__cpp_lib_span)
+template <typename Adt>
+[[nodiscard]] Result<std::size_t, WireError>
+serialize(const Adt &adt, std::span<std::byte> buffer) noexcept {
+  return serialize(adt, buffer.data(), buffer.size());
+}
+
+template <typename Adt>
+[[nodiscard]] Result<Adt, WireError>
+deserialize(std::span<const std::byte> bytes) noexcept {
+  return deserialize<Adt>(bytes.data(), bytes.size());
+}
+
+template <typename Adt>
+[[nodiscard]] Result<WireView<Adt>, WireError>
+view_as(std::span<const std::byte> bytes) noexcept {
+  return view_as<Adt>(bytes.data(), bytes.size());
+}
+#endif
+
+/**
+ * @brief Inspects a serialized Adt in place with the handlers Inspect would
+ *        take for a `const Adt &`, including the same coverage checks. Only
+ *        the payload of the handler that runs is read from the bytes.
+ */
+template <typename R = detail::deduce_return_type, typename Adt,
+          typename... Lambdas>
+[[nodiscard]] auto
+Inspect(const WireView<Adt> &view, Lambdas &&...lambdas) noexcept(
+    detail::nothrow_inspect<R, std::tuple<const Adt &>, Lambdas...>()) {
+  using VisitorType = detail::visitor_t<Lambdas...>;
+  detail::validate_inspectable<VisitorType, const Adt &>();
+
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  return view.decode([&](auto, const auto &...payload) {
+    if constexpr (std::is_same_v<R, detail::deduce_return_type>) {
+      return visitor(payload...);
+    } else {
+      return detail::returning<R, VisitorType>{visitor}(payload...);
+    }
+  });
+}
+
+} // namespace adt
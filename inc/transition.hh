@@ -0,0 +1,165 @@
+/**
+ * @file transition.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides Transition, which moves a std::variant state machine to
+ *        its next state: the handler of the current alternative takes it by
+ *        rvalue and returns the next state, or adt::stay.
+ * @version 0.1
+ * @date 2026-01-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "inspect.hh"
+
+namespace adt {
+
+/**
+ * @brief Returned by a Transition handler to keep the current state as it
+ *        is, including the changes the handler made to it in place.
+ */
+struct stay_t {
+  explicit constexpr stay_t() = default;
+};
+
+inline constexpr stay_t stay{};
+
+/**
+ * @brief What a handler returns when it may either stay or move on: a
+ *        std::variant of adt::stay_t and the possible next states.
+ */
+template <typename... States> using StayOr = std::variant<stay_t, States...>;
+
+namespace detail {
+
+template <typename Next, typename... Ts>
+inline constexpr bool is_next_state_v =
+    std::is_same_v<Next, stay_t> || (std::is_same_v<Next, Ts> + ... + 0) == 1;
+
+template <typename Next, typename Variant> struct transition_target;
+
+template <typename Next, typename... Ts>
+struct transition_target<Next, std::variant<Ts...>> {
+  static constexpr bool single = is_next_state_v<Next, Ts...>;
+  static constexpr bool choice = false;
+  static_assert(single,
+                "❌ TRANSITION ERROR: a handler must return adt::stay, one of "
+                "the alternatives, or a std::variant of those (such as the "
+                "state variant itself or adt::StayOr)!");
+};
+
+template <typename... Us, typename... Ts>
+struct transition_target<std::variant<Us...>, std::variant<Ts...>> {
+  static constexpr bool single = false;
+  static constexpr bool choice = (is_next_state_v<Us, Ts...> && ...);
+  static_assert(choice,
+                "❌ TRANSITION ERROR: every alternative of a std::variant "
+                "returned by a handler must be adt::stay_t or exactly one of "
+                "the alternatives of the state!");
+};
+
+/**
+ * @brief Called with the current alternative: runs its handler, then
+ *        stores the next state with the fewest operations. Returns whether
+ *        the variant now holds another alternative.
+ */
+template <typename Variant, typename Visitor> struct transition_step {
+  Variant &state;
+  Visitor &visitor;
+
+  template <typename Current, typename Next>
+  constexpr bool store(Current &current, Next &&next) {
+    using Raw = remove_cvref_t<Next>;
+    if constexpr (std::is_same_v<Raw, stay_t>) {
+      return false;
+    } else if constexpr (std::is_same_v<Raw, Current>) {
+      // Same alternative: assigned in place, the variant is left alone
+      current = std::forward<Next>(next);
+      return false;
+    } else {
+      // The next state is complete before the current one is destroyed,
+      // then moved into the variant once
+      state.template emplace<alternative_index<Raw, Variant>::value>(
+          std::forward<Next>(next));
+      return true;
+    }
+  }
+
+  template <typename Current> constexpr bool operator()(Current &&current) {
+    using Next =
+        remove_cvref_t<std::invoke_result_t<Visitor &, Current &&>>;
+    using Target = transition_target<Next, Variant>;
+    using Raw = remove_cvref_t<Current>;
+    Raw &held = current;
+
+    if constexpr (Target::single) {
+      return store(held, visitor(std::forward<Current>(current)));
+    } else if constexpr (Target::choice) {
+      return detail::visit(
+          [&](auto &&next) {
+            return store(held, std::forward<decltype(next)>(next));
+          },
+          visitor(std::forward<Current>(current)));
+    } else {
+      return false;
+    }
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief Moves a state machine to its next state. The handler matching the
+ *        current alternative receives it by rvalue, so it can move buffers
+ *        or handles into the state it returns:
+ *        - adt::stay keeps the current state (after in-place changes);
+ *        - the same alternative is move-assigned to the current one, without
+ *          touching the variant;
+ *        - another alternative is emplaced with a single move, after the
+ *          handler returned;
+ *        - a std::variant of those, such as adt::StayOr<Next> or the state
+ *          variant itself, is resolved the same way for the alternative it
+ *          holds. Returning a state through it costs one more move, unless
+ *          the handler constructs it in place (std::in_place_type).
+ *
+ * @return Whether the variant now holds a different alternative.
+ *
+ * @warning As with std::variant::emplace, if moving the next state into
+ *          the variant throws, the variant is left valueless.
+ *
+ * @note Usage:
+ * ```cpp
+ * std::variant<Idle, Connecting, Connected> state = Idle{std::move(buffer)};
+ * adt::Transition(
+ *     state,
+ *     [](Idle &&idle) { return Connecting{std::move(idle.buffer), 1}; },
+ *     [&](Connecting &&c) -> adt::StayOr<Connected> {
+ *       if (!ready) {
+ *         ++c.attempts;
+ *         return adt::stay;
+ *       }
+ *       return Connected{std::move(c.buffer), open_socket()};
+ *     },
+ *     [](Connected &&) { return adt::stay; });
+ * ```
+ */
+template <typename... Ts, typename... Lambdas>
+constexpr bool Transition(std::variant<Ts...> &state, Lambdas &&...lambdas) {
+  using Variant = std::variant<Ts...>;
+  using VisitorType = detail::visitor_t<Lambdas...>;
+  diagnostic::variant_validator<VisitorType, Variant &&>::validate();
+
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  return detail::visit(
+      detail::transition_step<Variant, VisitorType>{state, visitor},
+      std::move(state));
+}
+
+} // namespace adt
@@ -0,0 +1,255 @@
+/**
+ * @file try.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides early-return propagation of Result errors: the ADT_TRY and
+ *        ADT_TRY_ASSIGN macros and, in C++20, co_await on a Result inside a
+ *        coroutine that itself returns a Result.
+ * @version 0.1
+ * @date 2026-01-09
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <cassert>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "result.hh"
+
+/**
+ * @brief Whether the compiler delays converting get_return_object() to the
+ *        return type of a coroutine until it first suspends or returns, as
+ *        Result coroutines need: GCC, MSVC, Clang 17 and Apple Clang 16 (its
+ *        LLVM 17) do. Earlier Clang converts it before the body runs.
+ */
+#if defined(__clang__)
+#if defined(__apple_build_version__)
+#define ADT_DELAYED_RETURN_OBJECT (__clang_major__ >= 16)
+#else
+#define ADT_DELAYED_RETURN_OBJECT (__clang_major__ >= 17)
+#endif
+#elif defined(__GNUC__) || defined(_MSC_VER)
+#define ADT_DELAYED_RETURN_OBJECT 1
+#else
+#define ADT_DELAYED_RETURN_OBJECT 0
+#endif
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>) &&            \
+    ADT_DELAYED_RETURN_OBJECT
+#include <coroutine>
+#define ADT_RESULT_COROUTINES 1
+#else
+#define ADT_RESULT_COROUTINES 0
+#endif
+
+namespace adt {
+
+namespace detail {
+
+/**
+ * @brief The error of a failed Result as an Error<E>, moved out when the
+ *        Result is an rvalue. Converts to any Result<U, E>.
+ */
+template <typename R> constexpr auto take_error(R &&result) {
+  using E = typename std::decay_t<R>::error_type;
+  return Error<E>(std::forward<R>(result).unsafe_error());
+}
+
+/**
+ * @brief The value of a successful Result, moved out when the Result is an
+ *        rvalue. Returns nothing for Result<void, E>.
+ */
+template <typename R> constexpr auto take_value(R &&result) {
+  using T = typename std::decay_t<R>::value_type;
+  if constexpr (!std::is_void_v<T>) {
+    return T(*std::forward<R>(result));
+  }
+}
+
+} // namespace detail
+
+} // namespace adt
+
+#define ADT_TRY_CONCAT_IMPL(a, b) a##b
+#define ADT_TRY_CONCAT(a, b) ADT_TRY_CONCAT_IMPL(a, b)
+
+#define ADT_TRY_ASSIGN_IMPL(tmp, lhs, ...)                                     \
+  auto &&tmp = (__VA_ARGS__);                                                  \
+  if (!tmp.has_value()) {                                                      \
+    return ::adt::detail::take_error(std::forward<decltype(tmp)>(tmp));        \
+  }                                                                            \
+  lhs = ::adt::detail::take_value(std::forward<decltype(tmp)>(tmp))
+
+/**
+ * @brief Evaluates a Result and either returns its error from the enclosing
+ *        function or assigns its value to `lhs`, which may be a declaration.
+ *        Portable to every C++17 compiler.
+ *
+ * @note Usage:
+ * ```cpp
+ * adt::Result<Config, ParseError> load(std::string_view text) {
+ *   ADT_TRY_ASSIGN(auto port, parse_port(text));
+ *   ADT_TRY_ASSIGN(auto host, parse_host(text));
+ *   return adt::Ok(Config{host, port});
+ * }
+ * ```
+ */
+#define ADT_TRY_ASSIGN(lhs, ...)                                               \
+  ADT_TRY_ASSIGN_IMPL(ADT_TRY_CONCAT(adt_try_result_, __COUNTER__), lhs,       \
+                      __VA_ARGS__)
+
+#if defined(__GNUC__)
+/**
+ * @brief Rust's `?` operator: an expression that yields the value of a
+ *        Result, or returns its error from the enclosing function. The error
+ *        is moved out of an rvalue Result.
+ *
+ * @note Needs the statement expressions of GCC and Clang; use ADT_TRY_ASSIGN
+ *       elsewhere. Usage:
+ * ```cpp
+ * adt::Result<Config, ParseError> load(std::string_view text) {
+ *   return adt::Ok(Config{ADT_TRY(parse_host(text)),
+ *                         ADT_TRY(parse_port(text))});
+ * }
+ * ```
+ */
+#define ADT_TRY(...)                                                           \
+  ({                                                                           \
+    auto &&adt_try_result = (__VA_ARGS__);                                     \
+    if (!adt_try_result.has_value()) {                                         \
+      return ::adt::detail::take_error(                                        \
+          std::forward<decltype(adt_try_result)>(adt_try_result));             \
+    }                                                                          \
+    ::adt::detail::take_value(                                                 \
+        std::forward<decltype(adt_try_result)>(adt_try_result));               \
+  })
+#endif
+
+#if ADT_RESULT_COROUTINES
+
+namespace adt {
+
+namespace detail {
+
+template <typename T, typename E> class result_promise;
+
+/**
+ * @brief What a Result coroutine returns to its caller; the Result itself is
+ *        produced when the coroutine has finished, which always happens
+ *        before control leaves the call since it never suspends for long.
+ *
+ * @note Relies on the conversion of get_return_object() to the return type
+ *       being delayed while the types differ, so ADT_RESULT_COROUTINES is
+ *       only set where ADT_DELAYED_RETURN_OBJECT is.
+ */
+template <typename T, typename E> class result_return_object {
+  std::optional<Result<T, E>> _result;
+  result_promise<T, E> *_promise;
+
+public:
+  explicit result_return_object(result_promise<T, E> &promise) noexcept
+      : _promise(&promise) {
+    _promise->_result = &_result;
+  }
+
+  result_return_object(result_return_object &&other) noexcept
+      : _result(std::move(other._result)), _promise(other._promise) {
+    _promise->_result = &_result;
+  }
+
+  result_return_object(const result_return_object &) = delete;
+  result_return_object &operator=(const result_return_object &) = delete;
+  result_return_object &operator=(result_return_object &&) = delete;
+
+  operator Result<T, E>() && {
+    assert(_result.has_value() &&
+           "Result coroutine: converted before it finished!");
+    return std::move(*_result);
+  }
+};
+
+/**
+ * @brief Awaiter of co_await on a Result: resumes with the value, or stores
+ *        the error as the outcome of the coroutine and ends it.
+ */
+template <typename R, typename T, typename E> struct result_awaiter {
+  R &&_awaited;
+
+  bool await_ready() const noexcept { return _awaited.has_value(); }
+
+  void await_suspend(std::coroutine_handle<result_promise<T, E>> handle) {
+    handle.promise().return_value(
+        detail::take_error(std::forward<R>(_awaited)));
+    handle.destroy();
+  }
+
+  decltype(auto) await_resume() {
+    return detail::take_value(std::forward<R>(_awaited));
+  }
+};
+
+template <typename T, typename E> class result_promise {
+  template <typename, typename> friend class result_return_object;
+
+  std::optional<Result<T, E>> *_result = nullptr;
+
+public:
+  result_return_object<T, E> get_return_object() noexcept {
+    return result_return_object<T, E>(*this);
+  }
+
+  std::suspend_never initial_suspend() const noexcept { return {}; }
+  std::suspend_never final_suspend() const noexcept { return {}; }
+
+  void return_value(Result<T, E> result) {
+    _result->emplace(std::move(result));
+  }
+
+  void unhandled_exception() {
+#if ADT_HAS_EXCEPTIONS
+    throw;
+#else
+    detail::abort_with("Result coroutine: unhandled exception!");
+#endif
+  }
+
+  template <typename R,
+            std::enable_if_t<is_result<std::decay_t<R>>::value, int> = 0>
+  auto await_transform(R &&awaited) noexcept {
+    static_assert(
+        std::is_same_v<typename std::decay_t<R>::error_type, E>,
+        "❌ RESULT ERROR: co_await needs a Result with the same error type "
+        "as the coroutine!");
+    return result_awaiter<R, T, E>{std::forward<R>(awaited)};
+  }
+};
+
+} // namespace detail
+
+} // namespace adt
+
+/**
+ * @brief Lets a function returning adt::Result be a coroutine: `co_await`
+ *        on a Result yields its value or ends the coroutine with its error,
+ *        and `co_return` takes Ok<T>, Error<E> or a whole Result.
+ *
+ * @note The frame is destroyed before the call returns, which lets Clang
+ *       elide its heap allocation once the coroutine is inlined. GCC always
+ *       allocates it, so ADT_TRY stays the faster choice on hot paths.
+ * ```cpp
+ * adt::Result<Config, ParseError> load(std::string_view text) {
+ *   auto host = co_await parse_host(text);
+ *   auto port = co_await parse_port(text);
+ *   co_return adt::Ok(Config{host, port});
+ * }
+ * ```
+ */
+template <typename T, typename E, typename... Args>
+struct std::coroutine_traits<adt::Result<T, E>, Args...> {
+  using promise_type = adt::detail::result_promise<T, E>;
+};
+
+#endif
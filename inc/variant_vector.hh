@@ -0,0 +1,269 @@
+/**
+ * @file variant_vector.hh
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Provides VariantVector, a struct-of-arrays container for a sequence
+ *        of std::variant<Ts...> values: one dense lane per alternative and a
+ *        compact stream of tags recording the insertion order.
+ * @version 0.1
+ * @date 2026-01-07
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+#include "inspect_each.hh"
+
+namespace adt {
+
+namespace detail {
+
+template <typename T, typename... Ts> struct index_of;
+
+template <typename T, typename... Ts>
+struct index_of<T, T, Ts...> : index_constant<0> {};
+
+template <typename T, typename U, typename... Ts>
+struct index_of<T, U, Ts...>
+    : index_constant<1 + index_of<T, Ts...>::value> {};
+
+template <typename T, typename... Ts> struct is_one_of {
+  static constexpr bool value = (std::is_same_v<T, Ts> || ...);
+};
+
+template <typename... Ts> struct are_distinct : std::true_type {};
+template <typename T, typename... Ts>
+struct are_distinct<T, Ts...>
+    : std::bool_constant<!is_one_of<T, Ts...>::value &&
+                         are_distinct<Ts...>::value> {};
+
+} // namespace detail
+
+/**
+ * @brief The elements of one VariantVector lane, writable in place but of a
+ *        fixed length, so the lane cannot fall out of step with the tags.
+ */
+template <typename T> class LaneView {
+  T *_data;
+  std::size_t _size;
+
+public:
+  using value_type = T;
+  using iterator = T *;
+
+  constexpr LaneView(T *data, std::size_t size) noexcept
+      : _data(data), _size(size) {}
+
+  [[nodiscard]] constexpr T *data() const noexcept { return _data; }
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return _size; }
+  [[nodiscard]] constexpr bool empty() const noexcept { return _size == 0; }
+
+  [[nodiscard]] constexpr T *begin() const noexcept { return _data; }
+  [[nodiscard]] constexpr T *end() const noexcept { return _data + _size; }
+
+  [[nodiscard]] constexpr T &operator[](std::size_t index) const noexcept {
+    return _data[index];
+  }
+};
+
+/**
+ * @brief A sequence of std::variant<Ts...> values stored as one
+ *        std::vector per alternative plus a tag stream.
+ *
+ * @details Every element costs sizeof(T) of its own alternative and one tag
+ *          (a byte for up to 256 alternatives) instead of the size of the
+ *          largest alternative plus the variant index. Scans filtered by type
+ *          only touch the lane of that type, see lane().
+ *
+ * @note Iterate it with InspectEach: the partitioned form visits the lanes
+ *       one after another, the default form replays the tag stream and
+ *       visits the elements in insertion order.
+ * ```cpp
+ * adt::VariantVector<Tick, Trade, Halt> log;
+ * log.push_back(Tick{...});
+ * log.push_back(Trade{...});
+ *
+ * adt::InspectEach(adt::partitioned, log,
+ *                  [&](const Tick &) { ++ticks; },
+ *                  [&](const Trade &t) { volume += t.size; },
+ *                  [&](const Halt &) { halted = true; });
+ * ```
+ *
+ * @tparam Ts The alternatives, all distinct.
+ */
+template <typename... Ts> class VariantVector {
+  static_assert(sizeof...(Ts) > 0, "VariantVector needs an alternative.");
+  static_assert(detail::are_distinct<Ts...>::value,
+                "VariantVector alternatives must be distinct types.");
+
+public:
+  using variant_type = std::variant<Ts...>;
+  using tag_type = std::conditional_t<(sizeof...(Ts) <= 256), std::uint8_t,
+                                      std::uint16_t>;
+
+  template <typename T>
+  static constexpr std::size_t index_of_v = detail::index_of<T, Ts...>::value;
+
+  [[nodiscard]] std::size_t size() const noexcept { return _tags.size(); }
+  [[nodiscard]] bool empty() const noexcept { return _tags.empty(); }
+
+  void clear() noexcept {
+    _tags.clear();
+    std::apply([](auto &...lanes) { (lanes.clear(), ...); }, _lanes);
+  }
+
+  /**
+   * @brief Appends a new element holding alternative I, built in place. If
+   *        building it throws, the vector is left unchanged.
+   */
+  template <std::size_t I, typename... Args>
+  decltype(auto) emplace_back(Args &&...args) {
+    // Room for the tag first: once the element is in its lane, pushing the
+    // tag cannot fail and leave the lane one element ahead of the tags
+    if (_tags.size() == _tags.capacity()) {
+      _tags.reserve(_tags.empty() ? 16 : 2 * _tags.capacity());
+    }
+    auto &lane = std::get<I>(_lanes);
+    auto &element = lane.emplace_back(std::forward<Args>(args)...);
+    _tags.push_back(static_cast<tag_type>(I));
+    return element;
+  }
+
+  /**
+   * @brief Appends a new element holding alternative T, built in place.
+   */
+  template <typename T, typename... Args> T &emplace_back(Args &&...args) {
+    return emplace_back<index_of_v<T>>(std::forward<Args>(args)...);
+  }
+
+  template <typename T,
+            std::enable_if_t<detail::is_one_of<detail::remove_cvref_t<T>,
+                                               Ts...>::value,
+                             int> = 0>
+  void push_back(T &&value) {
+    emplace_back<detail::remove_cvref_t<T>>(std::forward<T>(value));
+  }
+
+  void push_back(const variant_type &variant) { push_variant(variant); }
+  void push_back(variant_type &&variant) { push_variant(std::move(variant)); }
+
+  /**
+   * @brief The dense array of all elements holding alternative T (or I), in
+   *        insertion order. Through a non-const vector the elements can be
+   *        modified, but elements are only added with push_back and
+   *        emplace_back, which keep the lanes and the tags in step.
+   */
+  template <typename T> [[nodiscard]] const std::vector<T> &lane() const {
+    return std::get<index_of_v<T>>(_lanes);
+  }
+  template <typename T> [[nodiscard]] LaneView<T> lane() {
+    return lane<index_of_v<T>>();
+  }
+  template <std::size_t I> [[nodiscard]] const auto &lane() const {
+    return std::get<I>(_lanes);
+  }
+  template <std::size_t I> [[nodiscard]] auto lane() {
+    auto &lane = std::get<I>(_lanes);
+    return LaneView<std::variant_alternative_t<I, variant_type>>(
+        lane.data(), lane.size());
+  }
+
+  /**
+   * @brief The alternative index of every element, in insertion order.
+   */
+  [[nodiscard]] const std::vector<tag_type> &tags() const noexcept {
+    return _tags;
+  }
+
+private:
+  std::tuple<std::vector<Ts>...> _lanes;
+  std::vector<tag_type> _tags;
+
+  template <typename Variant> void push_variant(Variant &&variant) {
+    detail::with_index<sizeof...(Ts)>(variant.index(), [&](auto index) {
+      constexpr std::size_t I = decltype(index)::value;
+      emplace_back<I>(
+          detail::get_alternative<I>(std::forward<Variant>(variant)));
+    });
+  }
+};
+
+namespace traits {
+template <typename... Ts>
+struct is_variant_vector_impl<VariantVector<Ts...>> : std::true_type {};
+} // namespace traits
+
+namespace detail {
+
+template <typename Visitor, typename VV, std::size_t... Is>
+void inspect_lanes(Visitor &visitor, VV &vector, std::index_sequence<Is...>) {
+  (
+      [&] {
+        for (auto &element : vector.template lane<Is>()) {
+          visitor(element);
+        }
+      }(),
+      ...);
+}
+
+template <typename VV, typename... Lambdas>
+constexpr void validate_variant_vector() {
+  using VisitorType = detail::visitor_t<Lambdas...>;
+  using Element =
+      std::conditional_t<std::is_const_v<std::remove_reference_t<VV>>,
+                         const typename remove_cvref_t<VV>::variant_type &,
+                         typename remove_cvref_t<VV>::variant_type &>;
+  diagnostic::variant_validator<VisitorType &, Element>::validate();
+}
+
+} // namespace detail
+
+/**
+ * @brief Inspects every element of a VariantVector in insertion order, by
+ *        replaying its tag stream.
+ */
+template <typename VV, typename... Lambdas,
+          std::enable_if_t<traits::is_variant_vector<VV>::value, int> = 0>
+void InspectEach(VV &&vector, Lambdas &&...lambdas) {
+  detail::validate_variant_vector<VV, Lambdas...>();
+
+  using RawVector = detail::remove_cvref_t<VV>;
+  constexpr std::size_t N =
+      std::variant_size_v<typename RawVector::variant_type>;
+
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  std::array<std::size_t, N> cursors{};
+  for (auto tag : vector.tags()) {
+    detail::with_index<N>(tag, [&](auto index) {
+      constexpr std::size_t I = decltype(index)::value;
+      visitor(vector.template lane<I>()[cursors[I]++]);
+    });
+  }
+}
+
+/**
+ * @brief Inspects every element of a VariantVector lane by lane: all
+ *        elements of the first alternative, then the second, and so on.
+ *        No sorting pass is needed, the storage is already partitioned.
+ */
+template <typename VV, typename... Lambdas,
+          std::enable_if_t<traits::is_variant_vector<VV>::value, int> = 0>
+void InspectEach(partitioned_t, VV &&vector, Lambdas &&...lambdas) {
+  detail::validate_variant_vector<VV, Lambdas...>();
+
+  using RawVector = detail::remove_cvref_t<VV>;
+  constexpr std::size_t N =
+      std::variant_size_v<typename RawVector::variant_type>;
+
+  auto visitor = detail::make_visitor(std::forward<Lambdas>(lambdas)...);
+  detail::inspect_lanes(visitor, vector, std::make_index_sequence<N>{});
+}
+
+} // namespace adt
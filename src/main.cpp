@@ -18,10 +18,26 @@
  * @copyright Copyright (c) 2026
  *
  */
+#include <array>
+#include <cstdlib>
+#include <exception>
 #include <iostream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
 
+#include "atomic_result.hh"
+#include "error_arena.hh"
+#include "error_chain.hh"
 #include "inspect.hh"
+#include "lazy_result.hh"
+#include "matcher.hh"
+#include "optional.hh"
+#include "pipeline.hh"
 #include "result.hh"
+#include "serialize.hh"
+#include "transition.hh"
+#include "try.hh"
 
 struct A {};
 struct B {};
@@ -29,6 +45,58 @@ struct C {};
 
 enum class ErrorCode { ERROR_ONE, ERROR_TWO };
 
+// Error codes with a spare value, so Result/Optional need no separate tag
+enum class IoError : std::uint8_t { NONE, TIMEOUT, CLOSED };
+template <>
+struct adt::niche_traits<IoError>
+    : adt::sentinel_niche<IoError, IoError::NONE> {};
+
+struct Node {
+  int id;
+};
+template <>
+struct adt::niche_traits<Node *> : adt::sentinel_niche<Node *, nullptr> {};
+
+// Config enums parsed at compile time into a table kept in .rodata
+enum class Colour : std::uint8_t { RED, GREEN, BLUE };
+enum class ParseError : std::uint8_t { NONE, UNKNOWN_NAME };
+template <>
+struct adt::niche_traits<ParseError>
+    : adt::sentinel_niche<ParseError, ParseError::NONE> {};
+
+constexpr adt::Result<Colour, ParseError> parse_colour(std::string_view name) {
+  if (name == "red") {
+    return adt::Ok(Colour::RED);
+  }
+  if (name == "green") {
+    return adt::Ok(Colour::GREEN);
+  }
+  if (name == "blue") {
+    return adt::Ok(Colour::BLUE);
+  }
+  return adt::Error(ParseError::UNKNOWN_NAME);
+}
+
+constexpr std::array<adt::Result<Colour, ParseError>, 4> colour_table{
+    parse_colour("red"), parse_colour("green"), parse_colour("blue"),
+    parse_colour("purple")};
+
+// Counts its destructions; copying it throws once `copies_left` runs out
+struct FragileCopy {
+  static inline int destroyed = 0;
+  int copies_left = -1; // no limit
+
+  FragileCopy() = default;
+  FragileCopy(const FragileCopy &other)
+      : copies_left(other.copies_left < 0 ? -1 : other.copies_left - 1) {
+    if (other.copies_left == 0) {
+      throw std::runtime_error("copy failed");
+    }
+  }
+  FragileCopy &operator=(const FragileCopy &) = default;
+  ~FragileCopy() { ++destroyed; }
+};
+
 void test_variant();
 void test_optional();
 void test_result();
@@ -37,6 +105,26 @@ void test_reference_to_optional();
 void test_reference_to_variant();
 void test_reference_to_result();
 
+void test_niche();
+void test_result_combinators();
+void test_multi_variant();
+void test_void_result();
+void test_constexpr();
+void test_try();
+void test_error_arena();
+void test_patterns();
+void test_serialize();
+void test_lazy_result();
+void test_atomic_result();
+void test_pipeline();
+void test_profile();
+void test_hot();
+void test_transition();
+void test_matcher();
+void test_error_chain();
+void test_result_exception_safety();
+void test_noexcept_valueless();
+
 int main() {
   std::cout << "Hello, World!" << std::endl;
 
@@ -48,6 +136,28 @@ int main() {
   test_reference_to_optional();
   test_reference_to_result();
 
+  test_niche();
+  test_result_combinators();
+  test_multi_variant();
+  test_void_result();
+  test_constexpr();
+  test_try();
+  test_error_arena();
+  test_patterns();
+  test_serialize();
+  test_lazy_result();
+  test_atomic_result();
+  test_pipeline();
+  test_profile();
+  test_hot();
+  test_transition();
+  test_matcher();
+  test_error_chain();
+  test_result_exception_safety();
+
+  // Last: ends the process from the terminate handler
+  test_noexcept_valueless();
+
   return 0;
 }
 
@@ -66,6 +176,16 @@ void test_variant() {
                    my_variant, [](A value) { return 'A'; },
                    [](B value) { return 'B'; }, [](C value) { return 'C'; })
             << std::endl;
+
+  auto is_a = [](A) noexcept { return true; };
+  auto is_other = [](auto) noexcept { return false; };
+  auto describe = [](auto) { return std::string("not A"); };
+  static_assert(adt::is_nothrow_inspectable_v<std::variant<A, B, C> &,
+                                              decltype(is_a),
+                                              decltype(is_other)>);
+  static_assert(!adt::is_nothrow_inspectable_v<std::variant<A, B, C> &,
+                                               decltype(is_a),
+                                               decltype(describe)>);
 }
 
 void test_optional() {
@@ -192,3 +312,869 @@ void test_reference_to_result() {
   //       std::cout << "Error: " << static_cast<int>(err) << std::endl;
   //     });
 }
+
+void test_niche() {
+  std::cout << "Testing Niche Optional and Result Inspect:" << std::endl;
+
+  static_assert(sizeof(adt::Optional<Node *>) == sizeof(Node *));
+  static_assert(sizeof(adt::Optional<IoError>) == sizeof(IoError));
+  static_assert(sizeof(adt::Result<Node *, IoError>) == 2 * sizeof(Node *));
+
+  Node node{7};
+  adt::Optional<Node *> found = &node;
+  std::cout << "Optional contains: "
+            << adt::Inspect<std::string>(
+                   found,
+                   [](Node *value) {
+                     return "Node " + std::to_string(value->id);
+                   },
+                   []() { return "No Node"; })
+            << std::endl;
+
+  adt::Result<Node *, IoError> read = adt::Error(IoError::TIMEOUT);
+  std::cout << "Result contains: ";
+  adt::Inspect(
+      read,
+      [](Node *value) { std::cout << "Node " << value->id << std::endl; },
+      [](IoError err) {
+        std::cout << "Error: " << static_cast<int>(err) << std::endl;
+      });
+}
+
+void test_result_combinators() {
+  std::cout << "Testing Result combinators:" << std::endl;
+
+  auto parse = [](std::string text) -> adt::Result<int, ErrorCode> {
+    if (text.empty()) {
+      return adt::Error(ErrorCode::ERROR_ONE);
+    }
+    return adt::Ok(std::stoi(text));
+  };
+
+  adt::Result<std::string, ErrorCode> input = adt::Ok(std::string("41"));
+  auto answer = std::move(input)
+                    .and_then(parse)
+                    .map([](int value) { return value + 1; })
+                    .transform_error([](ErrorCode err) {
+                      return "Error: " + std::to_string(static_cast<int>(err));
+                    });
+
+  std::cout << "Pipeline returned: "
+            << adt::Inspect<std::string>(
+                   answer,
+                   [](int value) { return "Value: " + std::to_string(value); },
+                   [](const std::string &err) { return err; })
+            << std::endl;
+
+  adt::Result<int, ErrorCode> failed = adt::Error(ErrorCode::ERROR_TWO);
+  std::cout << "Failed Result or default: " << failed.value_or(-1)
+            << std::endl;
+
+  // The error branch is expected to be rare: keep its handler out of line
+  std::cout << "Likely value: "
+            << adt::InspectLikely(
+                   parse("7"), [](int value) { return value; },
+                   [](ErrorCode) { return -1; })
+            << std::endl;
+}
+
+void test_multi_variant() {
+  std::cout << "Testing multi-variant Inspect:" << std::endl;
+
+  std::variant<A, B> state = A{};
+  std::variant<A, B, C> event = C{};
+
+  std::cout << "The pair matched: "
+            << adt::Inspect<std::string_view>(
+                   state, event, [](A, C) { return "A and C"; },
+                   [](B, auto) { return "B and anything"; },
+                   [](auto, auto) { return "something else"; })
+            << std::endl;
+
+  // Handlers returning int and long long agree only through Inspect<R>:
+  // deduced, the mix is rejected instead of truncated to int
+  using Wide = std::variant<A, B, C, int, long, short>;
+  const Wide left = C{};
+  const Wide right = 2;
+  std::cout << "The widened handlers: "
+            << adt::Inspect<long long>(
+                   state, event, [](A, C) { return 5000000000LL; },
+                   [](const auto &, const auto &) { return 0; })
+            << " "
+            << adt::Inspect<long long>(
+                   left, right, [](C, int n) { return n * 5000000000LL; },
+                   [](const auto &, const auto &) { return -1; })
+            << std::endl;
+}
+
+void test_void_result() {
+  std::cout << "Testing Result<void, E>:" << std::endl;
+
+  static_assert(sizeof(adt::Result<void, IoError>) == sizeof(IoError));
+
+  auto flush = [](bool ok) -> adt::Result<void, IoError> {
+    if (!ok) {
+      return adt::Error(IoError::TIMEOUT);
+    }
+    return adt::Ok();
+  };
+
+  auto report = [](const adt::Result<void, IoError> &status) {
+    return adt::Inspect<std::string>(
+        status, []() { return "Flushed"; },
+        [](IoError err) {
+          return "Error: " + std::to_string(static_cast<int>(err));
+        });
+  };
+
+  std::cout << "First flush: " << report(flush(true)) << std::endl;
+  std::cout << "Second flush: " << report(flush(false)) << std::endl;
+
+  auto bytes = flush(true).map([]() { return 512; });
+  std::cout << "Bytes written: " << bytes.value_or(0) << std::endl;
+}
+
+void test_constexpr() {
+  std::cout << "Testing constexpr Result and Inspect:" << std::endl;
+
+  static_assert(colour_table[1].value() == Colour::GREEN);
+  static_assert(colour_table[3].error() == ParseError::UNKNOWN_NAME);
+  static_assert(*colour_table[2] == Colour::BLUE);
+
+  constexpr auto colour_code = [](const adt::Result<Colour, ParseError> &r) {
+    return adt::Inspect(
+        r, [](Colour colour) { return static_cast<int>(colour); },
+        [](ParseError) { return -1; });
+  };
+  static_assert(colour_code(colour_table[0]) == 0);
+  static_assert(colour_code(colour_table[3]) == -1);
+
+  constexpr adt::Result<int, ErrorCode> doubled =
+      adt::Result<int, ErrorCode>(adt::Ok(21)).map(
+          [](int value) { return value * 2; });
+  static_assert(doubled.value() == 42);
+  static_assert(adt::Result<int, ErrorCode>(adt::Error(ErrorCode::ERROR_ONE))
+                    .value_or(-1) == -1);
+
+  constexpr adt::Result<int, int> same = adt::Error(3);
+  static_assert(adt::Inspect<long>(
+                    same, [](adt::Ok<int>) { return 0; },
+                    [](adt::Error<int> err) { return err.get(); }) == 3);
+
+  constexpr adt::Result<void, IoError> flushed = adt::Ok();
+  static_assert(adt::Inspect(
+      flushed, []() { return true; }, [](IoError) { return false; }));
+
+  constexpr std::variant<A, B, C> state = B{};
+  static_assert(adt::Inspect(
+                    state, [](A) { return 'a'; }, [](B) { return 'b'; },
+                    [](C) { return 'c'; }) == 'b');
+  static_assert(adt::Inspect(
+                    state, std::variant<A, C>{C{}},
+                    [](B, C) { return 1; }, [](auto, auto) { return 0; }) == 1);
+
+  constexpr adt::Optional<Node *> missing;
+  static_assert(adt::Inspect(
+                    missing, [](Node *) { return 1; }, []() { return 0; }) ==
+                0);
+
+  std::cout << "Colour table: ";
+  for (const auto &entry : colour_table) {
+    std::cout << colour_code(entry) << ' ';
+  }
+  std::cout << std::endl;
+}
+
+adt::Result<int, ErrorCode> parse_digit(char c) {
+  if (c < '0' || c > '9') {
+    return adt::Error(ErrorCode::ERROR_ONE);
+  }
+  return adt::Ok(c - '0');
+}
+
+adt::Result<int, ErrorCode> parse_two_digits(std::string_view text) {
+  if (text.size() != 2) {
+    return adt::Error(ErrorCode::ERROR_TWO);
+  }
+  ADT_TRY_ASSIGN(int tens, parse_digit(text[0]));
+  ADT_TRY_ASSIGN(int units, parse_digit(text[1]));
+  return adt::Ok(tens * 10 + units);
+}
+
+#if ADT_RESULT_COROUTINES
+adt::Result<int, ErrorCode> parse_two_digits_co(std::string_view text) {
+  if (text.size() != 2) {
+    co_return adt::Error(ErrorCode::ERROR_TWO);
+  }
+  const int tens = co_await parse_digit(text[0]);
+  const int units = co_await parse_digit(text[1]);
+  co_return adt::Ok(tens * 10 + units);
+}
+#endif
+
+void test_try() {
+  std::cout << "Testing ADT_TRY:" << std::endl;
+
+  auto show = [](const adt::Result<int, ErrorCode> &result) {
+    return adt::Inspect<std::string>(
+        result, [](int value) { return std::to_string(value); },
+        [](ErrorCode err) {
+          return "Error: " + std::to_string(static_cast<int>(err));
+        });
+  };
+
+  std::cout << "\"42\" parsed to: " << show(parse_two_digits("42"))
+            << std::endl;
+  std::cout << "\"4x\" parsed to: " << show(parse_two_digits("4x"))
+            << std::endl;
+#if ADT_RESULT_COROUTINES
+  std::cout << "\"17\" parsed by a coroutine to: "
+            << show(parse_two_digits_co("17")) << std::endl;
+#endif
+}
+
+void test_error_arena() {
+  std::cout << "Testing ErrorArena:" << std::endl;
+
+  using Message = std::pmr::string;
+  adt::ErrorArenaScope scope;
+
+  adt::Result<int, Message> failed = adt::Error<Message>(
+      std::allocator_arg, scope.arena().allocator(),
+      "the configuration store has no entry for this key");
+  std::cout << "Message kept in the arena: " << std::boolalpha
+            << (failed.error().get_allocator().resource() ==
+                scope.arena().resource())
+            << std::endl;
+
+  // Containers of Results hand their allocator down to the payloads
+  std::pmr::vector<adt::Result<int, Message>> log(scope.arena().resource());
+  log.emplace_back(std::move(failed));
+  log.emplace_back(adt::Ok(7));
+  std::cout << "Logged error: "
+            << adt::Inspect<std::string>(
+                   log.front(), [](int value) { return std::to_string(value); },
+                   [](const Message &message) {
+                     return std::string(message);
+                   })
+            << std::endl;
+}
+
+// HTTP-like status codes classified by value patterns at compile time
+constexpr std::string_view classify_status(std::variant<int, IoError> status) {
+  return adt::Inspect(
+      status, adt::eq(204, [](int) { return "no content"; }),
+      adt::range(200, 299, [](int) { return "success"; }),
+      adt::range(400, 599, [](int) { return "failure"; }),
+      adt::eq(IoError::TIMEOUT, [](IoError) { return "timed out"; }),
+      [](int) { return "other"; }, [](IoError) { return "i/o error"; });
+}
+
+static_assert(classify_status(204) == "no content");
+static_assert(classify_status(201) == "success");
+static_assert(classify_status(503) == "failure");
+static_assert(classify_status(IoError::TIMEOUT) == "timed out");
+static_assert(classify_status(IoError::CLOSED) == "i/o error");
+
+void test_patterns() {
+  std::cout << "Testing Inspect patterns:" << std::endl;
+
+  auto describe = [](const std::variant<int, std::string> &reading) {
+    return adt::Inspect<std::string>(
+        reading,
+        adt::when(
+            [](int value) { return value < 0; },
+            [](int value) { return "negative " + std::to_string(value); }),
+        adt::eq(0, [](int) { return "zero"; }),
+        adt::eq("n/a", [](const std::string &) { return "not available"; }),
+        [](int value) { return std::to_string(value); },
+        [](const std::string &text) { return "text " + text; });
+  };
+
+  std::cout << "-3 is: " << describe(-3) << std::endl;
+  std::cout << "0 is: " << describe(0) << std::endl;
+  std::cout << "8 is: " << describe(8) << std::endl;
+  std::cout << "\"n/a\" is: " << describe(std::string("n/a")) << std::endl;
+  std::cout << "\"ok\" is: " << describe(std::string("ok")) << std::endl;
+
+  adt::Result<int, ErrorCode> count = adt::Ok(120);
+  std::cout << "Count of 120 is: "
+            << adt::Inspect<std::string_view>(
+                   count, adt::range(0, 99, [](int) { return "small"; }),
+                   adt::eq(ErrorCode::ERROR_TWO, [](ErrorCode) {
+                     return "retryable";
+                   }),
+                   [](int) { return "large"; },
+                   [](ErrorCode) { return "failed"; })
+            << std::endl;
+
+  // A pattern only takes the alternatives its test and handler accept, and
+  // is part of the noexcept analysis of Inspect
+  auto on_zero = adt::eq(0, [](int) noexcept {});
+  auto on_zero_throwing = adt::eq(0, [](int) {});
+  auto on_any = [](const auto &) noexcept {};
+  static_assert(adt::is_nothrow_inspectable_v<
+                const std::variant<int, std::string> &, decltype(on_zero),
+                decltype(on_any)>);
+  static_assert(!adt::is_nothrow_inspectable_v<
+                const std::variant<int, std::string> &,
+                decltype(on_zero_throwing), decltype(on_any)>);
+}
+
+// Events sent between processes as one tag byte plus their payload
+struct Tick {
+  std::uint64_t timestamp;
+  double price;
+};
+// Holds a double, so its lack of padding has to be stated
+template <> struct adt::is_padding_free<Tick> : std::true_type {};
+struct Shutdown {};
+using Event = std::variant<Tick, Shutdown, IoError>;
+
+static_assert(adt::max_serialized_size_v<Event> == 1 + sizeof(Tick));
+static_assert(adt::max_serialized_size_v<adt::Result<void, IoError>> == 2);
+
+void test_serialize() {
+  std::cout << "Testing serialize and WireView:" << std::endl;
+
+  // Back-to-back messages in one buffer, as in a socket read or a file
+  std::array<std::byte, 64> buffer{};
+  std::size_t used = 0;
+  for (const Event &event :
+       {Event(Tick{1700000000, 101.25}), Event(Shutdown{}),
+        Event(IoError::CLOSED)}) {
+    used += adt::serialize(event, buffer.data() + used, buffer.size() - used)
+                .value_or(0);
+  }
+  std::cout << "Three events take " << used << " bytes" << std::endl;
+
+  for (std::size_t at = 0; at < used;) {
+    auto view = adt::view_as<Event>(buffer.data() + at, used - at);
+    std::cout << "Event at " << at << ": "
+              << adt::Inspect<std::string>(
+                     *view,
+                     [](const Tick &tick) {
+                       return "tick at " + std::to_string(tick.price);
+                     },
+                     [](Shutdown) { return "shutdown"; },
+                     [](IoError err) {
+                       return "i/o error " +
+                              std::to_string(static_cast<int>(err));
+                     })
+              << std::endl;
+    at += view->size();
+  }
+
+  adt::Result<int, ErrorCode> reply = adt::Error(ErrorCode::ERROR_TWO);
+  const std::size_t size =
+      adt::serialize(reply, buffer.data(), buffer.size()).value();
+  auto decoded = adt::deserialize<adt::Result<int, ErrorCode>>(
+      buffer.data(), size);
+  std::cout << "Reply read back as error " << std::boolalpha
+            << (decoded.has_value() &&
+                decoded->error() == ErrorCode::ERROR_TWO)
+            << std::endl;
+
+  auto truncated = adt::view_as<Event>(buffer.data(), 0);
+  std::cout << "Empty bytes are truncated: "
+            << (truncated.error() == adt::WireError::TRUNCATED) << std::endl;
+
+  // An error tag with the niche sentinel would read back as a value
+  const std::byte forged[] = {std::byte{1},
+                              static_cast<std::byte>(IoError::NONE)};
+  auto rejected =
+      adt::deserialize<adt::Result<int, IoError>>(forged, sizeof(forged));
+  std::cout << "Sentinel error rejected: "
+            << (rejected.error() == adt::WireError::BAD_PAYLOAD) << std::endl;
+}
+
+void test_lazy_result() {
+  std::cout << "Testing LazyResult:" << std::endl;
+
+  int resolves = 0;
+  adt::LazyResult port([&]() -> adt::Result<int, ErrorCode> {
+    ++resolves;
+    return adt::Ok(8080);
+  });
+  std::cout << "Resolved before use: " << std::boolalpha << port.evaluated()
+            << std::endl;
+
+  for (int i = 0; i < 3; ++i) {
+    adt::Inspect(
+        port, [](int value) { std::cout << "Port: " << value << std::endl; },
+        [](ErrorCode) { std::cout << "No port" << std::endl; });
+  }
+  std::cout << "Resolved " << resolves << " time(s)" << std::endl;
+
+  // Type-erased producer, and the thread-safe form read like any Result
+  adt::LazyResult<void, ErrorCode> flush([]() -> adt::Result<void, ErrorCode> {
+    return adt::Error(ErrorCode::ERROR_ONE);
+  });
+  std::cout << "Flush failed: " << flush.has_error() << std::endl;
+
+  adt::SharedLazyResult shared(
+      []() -> adt::Result<std::string, ErrorCode> {
+        return adt::Ok(std::string("shared"));
+      });
+  std::cout << "Shared value: " << shared.value_or("none") << std::endl;
+
+  // A throwing producer caches nothing: the next access runs it again
+  int attempts = 0;
+  adt::LazyResult flaky([&]() -> adt::Result<int, ErrorCode> {
+    if (++attempts == 1) {
+      throw std::runtime_error("not yet");
+    }
+    return adt::Ok(attempts);
+  });
+  const auto on_value = [](int value) noexcept { return value; };
+  const auto on_error = [](ErrorCode) noexcept { return -1; };
+  static_assert(!noexcept(adt::Inspect(flaky, on_value, on_error)),
+                "a lazy Inspect must not be noexcept: it runs the producer");
+  const auto read = [&] { return adt::Inspect(flaky, on_value, on_error); };
+  try {
+    static_cast<void>(read());
+  } catch (const std::runtime_error &error) {
+    std::cout << "First attempt threw: " << error.what()
+              << ", evaluated: " << flaky.evaluated() << std::endl;
+  }
+  std::cout << "Retried: " << read() << " after " << attempts << " attempts"
+            << std::endl;
+}
+
+void test_atomic_result() {
+  std::cout << "Testing AtomicResult:" << std::endl;
+
+  using Status = adt::Result<std::uint32_t, IoError>;
+  static_assert(adt::AtomicResult<std::uint32_t, IoError>::is_always_lock_free);
+  static_assert(sizeof(adt::AtomicResult<std::uint32_t, IoError>) == 8);
+  // A niche type needs no tag: the empty state is its sentinel
+  static_assert(sizeof(adt::AtomicOptional<IoError>) == sizeof(IoError));
+
+  adt::AtomicResult<std::uint32_t, IoError> status{Status(adt::Ok(0u))};
+  status.store(adt::Ok(42u));
+  adt::Inspect(
+      status,
+      [](std::uint32_t done) {
+        std::cout << "Progress: " << done << std::endl;
+      },
+      [](IoError) { std::cout << "Failed" << std::endl; });
+
+  const Status previous = status.exchange(adt::Error(IoError::TIMEOUT));
+  std::cout << "Previous: " << previous.value_or(0u) << ", now failed: "
+            << std::boolalpha << status.load().has_error() << std::endl;
+
+  // A stale expected value fails and reloads the current one
+  Status expected = adt::Ok(42u);
+  const bool swapped = status.compare_exchange_strong(expected, adt::Ok(1u));
+  std::cout << "Swapped stale: " << swapped
+            << ", reloaded error: " << expected.has_error() << std::endl;
+  while (!status.compare_exchange_weak(expected, adt::Ok(1u))) {
+  }
+  std::cout << "Swapped: " << status.load().value_or(0u) << std::endl;
+
+  adt::AtomicResult<void, ErrorCode> flushed{
+      adt::Result<void, ErrorCode>(adt::Ok())};
+  flushed.store(adt::Error(ErrorCode::ERROR_TWO));
+  std::cout << "Flush failed: " << flushed.load().has_error() << std::endl;
+
+  adt::AtomicOptional<IoError> last_error;
+  last_error.store(IoError::CLOSED);
+  std::cout << "Last error: "
+            << adt::Inspect(
+                   last_error,
+                   [](IoError err) { return static_cast<int>(err); },
+                   [] { return -1; })
+            << std::endl;
+
+  adt::AtomicOptional<std::uint32_t> pending;
+  adt::Optional<std::uint32_t> nothing;
+  std::cout << "Claimed: "
+            << pending.compare_exchange_strong(nothing, 7u) << ", pending: "
+            << pending.load().value_or(0u) << std::endl;
+}
+
+void test_pipeline() {
+  std::cout << "Testing Pipeline:" << std::endl;
+
+  auto checked = adt::pipeline<int, ParseError>(adt::pipeline_policy{4, 2})
+                     .then([](int n) -> adt::Result<int, ParseError> {
+                       if (n % 10 == 0) {
+                         return adt::Error(ParseError::UNKNOWN_NAME);
+                       }
+                       return adt::Ok(n);
+                     })
+                     .then([](int n) { return static_cast<long>(n) * n; })
+                     .then([](long n) -> adt::Result<std::string, ParseError> {
+                       return adt::Ok(std::to_string(n));
+                     });
+
+  std::vector<adt::Result<int, ParseError>> inputs;
+  for (int i = 1; i <= 100; ++i) {
+    if (i == 7) {
+      inputs.emplace_back(adt::Error(ParseError::UNKNOWN_NAME));
+    } else {
+      inputs.emplace_back(adt::Ok(i));
+    }
+  }
+
+  std::size_t values = 0;
+  std::size_t text = 0;
+  std::size_t errors = 0;
+  checked.run(
+      inputs,
+      [&](std::string &&square) {
+        ++values;
+        text += square.size();
+      },
+      [&](ParseError) { ++errors; });
+  std::cout << "Values: " << values << ", digits: " << text
+            << ", errors: " << errors << std::endl;
+
+  for (std::size_t stage = 0; stage < checked.stage_count(); ++stage) {
+    const adt::stage_stats stats = checked.stats(stage);
+    std::cout << "Stage " << stage << ": " << stats.items << " items, "
+              << stats.error_rate() * 100 << "% errors" << std::endl;
+  }
+
+  // A throwing stage stops the run and its exception reaches the caller
+  auto failing = adt::pipeline<int, ParseError>().then([](int n) {
+    if (n == 3) {
+      throw std::runtime_error("stage failed");
+    }
+    return n;
+  });
+  try {
+    failing.run(std::vector<int>{1, 2, 3, 4}, [](int) {}, [](ParseError) {});
+  } catch (const std::runtime_error &err) {
+    std::cout << "Caught: " << err.what() << std::endl;
+  }
+}
+
+void test_profile() {
+  std::cout << "Testing Inspect profiling:" << std::endl;
+
+  std::size_t handled = 0;
+  for (int i = 0; i < 10; ++i) {
+    std::variant<int, IoError> reading;
+    if (i % 4 == 3) {
+      reading = IoError::TIMEOUT;
+    } else {
+      reading = i;
+    }
+    handled += adt::Inspect(
+        reading, [](int) { return std::size_t{1}; },
+        [](IoError) { return std::size_t{1}; });
+  }
+  std::cout << "Handled: " << handled << std::endl;
+
+#if ADT_INSPECT_PROFILE
+  for (const adt::profile::site_report &report : adt::profile::sites()) {
+    if (report.kind == adt::profile::site_kind::VARIANT &&
+        report.total() == 10 && report.hits[1] == 2) {
+      std::cout << "Site hits: " << report.hits[0] << " int, "
+                << report.hits[1] << " error" << std::endl;
+    }
+  }
+  adt::profile::dump(std::cout);
+#else
+  std::cout << "Profiling disabled (build with -DADT_INSPECT_PROFILE=1)"
+            << std::endl;
+#endif
+}
+
+// The hot alternative is tested first, the others go through the switch
+constexpr int hot_code(std::variant<int, IoError, std::string_view> status) {
+  return adt::Inspect<adt::hot<int>>(
+      status, [](int code) { return code; },
+      [](IoError err) { return -static_cast<int>(err); },
+      [](std::string_view text) { return static_cast<int>(text.size()); });
+}
+
+static_assert(hot_code(200) == 200);
+static_assert(hot_code(IoError::CLOSED) == -2);
+static_assert(hot_code(std::string_view("abc")) == 3);
+
+void test_hot() {
+  std::cout << "Testing hot alternatives:" << std::endl;
+
+  std::variant<A, B, C> message = B{};
+  for (int i = 0; i < 2; ++i) {
+    std::cout << "Message: "
+              << adt::Inspect<adt::hot<B, std::string>>(
+                     message, [](A) { return "A"; }, [](B) { return "B"; },
+                     [](C) { return "C"; })
+              << std::endl;
+    message = C{};
+  }
+
+  auto on_b = [](B) noexcept { return 1; };
+  auto on_other = [](auto) noexcept { return 0; };
+  static_assert(noexcept(adt::Inspect<adt::hot<B>>(message, on_b, on_other)));
+  std::cout << "Is B: " << adt::Inspect<adt::hot<B>>(message, on_b, on_other)
+            << std::endl;
+}
+
+// Counts the moves of the state objects, not of what they own
+struct MoveCount {
+  static inline int moves = 0;
+  MoveCount() = default;
+  MoveCount(MoveCount &&) noexcept { ++moves; }
+  MoveCount &operator=(MoveCount &&) noexcept {
+    ++moves;
+    return *this;
+  }
+};
+
+struct Idle {
+  std::vector<char> buffer;
+  MoveCount tracked;
+};
+struct Connecting {
+  std::vector<char> buffer;
+  int attempts = 0;
+  MoveCount tracked;
+};
+struct Connected {
+  std::vector<char> buffer;
+  MoveCount tracked;
+};
+
+using Connection = std::variant<Idle, Connecting, Connected>;
+
+void test_transition() {
+  std::cout << "Testing Transition:" << std::endl;
+
+  Connection state = Idle{std::vector<char>(64), {}};
+  const char *data = std::get<Idle>(state).buffer.data();
+
+  auto step = [&](bool ready) {
+    return adt::Transition(
+        state,
+        [](Idle &&idle) {
+          return Connecting{std::move(idle.buffer), 1, {}};
+        },
+        [&](Connecting &&connecting) -> Connection {
+          if (ready) {
+            return Connected{std::move(connecting.buffer), {}};
+          }
+          return Connecting{std::move(connecting.buffer),
+                            connecting.attempts + 1, {}};
+        },
+        [](Connected &&) { return adt::stay; });
+  };
+
+  MoveCount::moves = 0;
+  const bool changed = step(false);
+  std::cout << "Idle -> Connecting: changed " << std::boolalpha << changed
+            << ", state moves: " << MoveCount::moves << std::endl;
+
+  step(false);
+  std::cout << "Attempts: " << std::get<Connecting>(state).attempts
+            << std::endl;
+  step(true);
+  std::cout << "Connected: " << std::holds_alternative<Connected>(state)
+            << ", stays: " << !step(true) << ", buffer kept: "
+            << (std::get<Connected>(state).buffer.data() == data)
+            << std::endl;
+
+  // Same alternative returned: assigned in place, no variant assignment
+  Connection retry{std::in_place_type<Connecting>};
+  MoveCount::moves = 0;
+  adt::Transition(
+      retry,
+      [](Connecting &&c) {
+        return Connecting{std::move(c.buffer), c.attempts + 1, {}};
+      },
+      [](auto &&) { return adt::stay; });
+  std::cout << "Retry moves: " << MoveCount::moves << ", attempts: "
+            << std::get<Connecting>(retry).attempts << std::endl;
+
+  // Staying put after an in-place change moves nothing
+  MoveCount::moves = 0;
+  for (int i = 0; i < 3; ++i) {
+    adt::Transition(
+        retry,
+        [](Connecting &&c) -> adt::StayOr<Connected> {
+          if (++c.attempts < 3) {
+            return adt::stay;
+          }
+          return Connected{std::move(c.buffer), {}};
+        },
+        [](auto &&) { return adt::stay; });
+  }
+  std::cout << "Waited with " << MoveCount::moves
+            << " move(s), connected: "
+            << std::holds_alternative<Connected>(retry) << std::endl;
+}
+
+void test_matcher() {
+  std::cout << "Testing Matcher:" << std::endl;
+
+  using Describe = adt::Matcher<std::variant<A, B, C>, std::string>;
+  const std::string prefix = "got ";
+  Describe describe([&](const A &) { return prefix + "A"; },
+                    [&](const B &) { return prefix + "B"; },
+                    [](const auto &) { return std::string("other"); });
+
+  // Built once, applied to many values
+  const std::vector<std::variant<A, B, C>> values{A{}, C{}, B{}};
+  for (const auto &value : values) {
+    std::cout << describe(value) << std::endl;
+  }
+  std::cout << "Inline: " << std::boolalpha << describe.stored_inline()
+            << std::endl;
+
+  // Picked at run time, like any other value
+  Describe quiet([](const auto &) { return std::string("..."); });
+  Describe chosen = values.size() > 2 ? quiet : describe;
+  std::cout << "Chosen: " << chosen(values[0]) << std::endl;
+  chosen = describe;
+  std::cout << "Reassigned: " << chosen(values[0]) << std::endl;
+
+  // Captures too large for the buffer go to the heap, once
+  std::array<long, 16> weights{};
+  weights[1] = 7;
+  adt::Matcher<std::variant<int, std::string>, long> weigh(
+      [weights](int i) { return weights[1] * i; },
+      [weights](const std::string &s) {
+        return weights[0] + static_cast<long>(s.size());
+      });
+  auto moved = std::move(weigh);
+  std::cout << "Weighed: " << moved(std::variant<int, std::string>{3})
+            << ", inline: " << moved.stored_inline() << std::endl;
+
+  // Non-const references reach the handlers as such
+  adt::Matcher<std::variant<int, std::string> &> bump(
+      [](int &i) { ++i; }, [](std::string &s) { s += "!"; });
+  std::variant<int, std::string> counter = 1;
+  bump(counter);
+  bump(counter);
+  std::cout << "Bumped: " << std::get<int>(counter) << std::endl;
+}
+
+// Contexts are attached while the error travels up, formatted only when read
+adt::Result<int, IoError> read_block(int block) {
+  if (block < 0) {
+    return adt::Error(IoError::TIMEOUT);
+  }
+  return adt::Ok(block * 512);
+}
+
+adt::Result<int, adt::ErrorChain<IoError>> read_header(int block) {
+  ADT_TRY_ASSIGN(const int offset,
+                 adt::with_context(read_block(block),
+                                   ADT_CONTEXT("reading the header")));
+  return adt::Ok(offset + 16);
+}
+
+adt::Result<void, adt::ErrorChain<IoError>> load_volume(int block) {
+  ADT_TRY_ASSIGN(const int header,
+                 adt::with_context(read_header(block),
+                                   ADT_CONTEXT("loading the volume")));
+  static_cast<void>(header);
+  return adt::Ok();
+}
+
+// The contexts live in the interned node table: a Result stays 8 bytes
+static_assert(sizeof(adt::Result<std::int32_t, adt::ErrorChain<IoError>>) ==
+              8);
+
+void test_error_chain() {
+  std::cout << "Testing ErrorChain:" << std::endl;
+
+  auto show = [](const adt::Result<void, adt::ErrorChain<IoError>> &result) {
+    adt::Inspect(
+        result, [] { std::cout << "Volume loaded" << std::endl; },
+        [](const adt::ErrorChain<IoError> &chain) {
+          std::cout << "Failed: " << chain << std::endl;
+        });
+  };
+  show(adt::with_context(load_volume(3), ADT_CONTEXT("mounting /data")));
+  const auto failed = adt::with_context(load_volume(-1),
+                                        ADT_CONTEXT("mounting /data"));
+  show(failed);
+
+  // The chain only refers to the literals themselves
+  const char *innermost = nullptr;
+  failed.error().each_context([&](const char *context) {
+    innermost = context;
+  });
+  std::cout << "Contexts: " << failed.error().depth() << ", innermost: \""
+            << innermost << "\"" << std::endl;
+
+  adt::ErrorChain<std::string> described("disk full");
+  described.with_context(ADT_CONTEXT("saving"))
+      .with_context(ADT_CONTEXT("exiting"));
+  described.format(std::cout, [](std::ostream &out, const std::string &e) {
+    out << "<" << e << ">";
+  });
+  std::cout << std::endl;
+}
+
+void test_result_exception_safety() {
+  std::cout << "Testing Result exception safety:" << std::endl;
+
+  adt::Result<FragileCopy, ErrorCode> source = adt::Ok(FragileCopy{});
+  source.value().copies_left = 0;
+
+  // A copy that throws leaves nothing behind to destroy
+  const int destroyed = FragileCopy::destroyed;
+  try {
+    const adt::Result<FragileCopy, ErrorCode> copy = source;
+    std::cout << "Copied: " << copy.has_value() << std::endl;
+  } catch (const std::runtime_error &err) {
+    std::cout << "Caught: " << err.what() << ", destroyed: "
+              << FragileCopy::destroyed - destroyed << std::endl;
+  }
+
+  // The same holds for the allocator-extended copy
+  try {
+    const adt::Result<FragileCopy, ErrorCode> copy(
+        std::allocator_arg, std::allocator<FragileCopy>(), source);
+    std::cout << "Copied: " << copy.has_value() << std::endl;
+  } catch (const std::runtime_error &err) {
+    std::cout << "Caught: " << err.what() << ", destroyed: "
+              << FragileCopy::destroyed - destroyed << std::endl;
+  }
+
+  // Switching to a value whose copy throws midway keeps the old error
+  adt::Result<FragileCopy, ErrorCode> target = adt::Error(ErrorCode::ERROR_TWO);
+  source.value().copies_left = 1;
+  try {
+    target = source;
+  } catch (const std::runtime_error &err) {
+    std::cout << "Caught: " << err.what() << ", still an error: "
+              << (target.error() == ErrorCode::ERROR_TWO) << std::endl;
+  }
+  source.value().copies_left = -1;
+  target = source;
+  std::cout << "Assigned: " << target.has_value() << std::endl;
+}
+
+void test_noexcept_valueless() {
+  std::cout << "Testing noexcept Inspect of a valueless variant:"
+            << std::endl;
+
+  // A copy that throws while emplacing leaves the variant valueless
+  std::variant<int, FragileCopy> held = 0;
+  FragileCopy armed;
+  armed.copies_left = 0;
+  try {
+    held.emplace<FragileCopy>(armed);
+  } catch (const std::runtime_error &) {
+  }
+  std::cout << "Valueless: " << held.valueless_by_exception() << std::endl;
+
+  auto on_int = [](int) noexcept { return 0; };
+  auto on_fragile = [](const FragileCopy &) noexcept { return 1; };
+  static_assert(noexcept(adt::Inspect(held, on_int, on_fragile)));
+
+  // The bad_variant_access cannot leave a noexcept Inspect: terminate
+  std::set_terminate([] {
+    std::cout << "std::terminate called" << std::endl;
+    std::_Exit(EXIT_SUCCESS);
+  });
+  static_cast<void>(adt::Inspect(held, on_int, on_fragile));
+  std::cout << "Inspect returned from a valueless variant" << std::endl;
+  std::_Exit(EXIT_FAILURE);
+}
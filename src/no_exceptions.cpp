@@ -0,0 +1,92 @@
+/**
+ * @file no_exceptions.cpp
+ * @author Bartosz Ksel (bartoszmateusz.ksel@gmail.com)
+ * @brief Built with -fno-exceptions -fno-rtti: checks that Inspect, Result
+ *        and Optional compile without any throw path, and that a contract
+ *        violation reaches the installed panic handler.
+ * @version 0.1
+ * @date 2026-01-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <variant>
+
+#include "inspect.hh"
+#include "matcher.hh"
+#include "optional.hh"
+#include "result.hh"
+#include "try.hh"
+
+#if ADT_HAS_EXCEPTIONS || defined(__GXX_RTTI)
+#error "no_exceptions.cpp must be built with -fno-exceptions -fno-rtti"
+#endif
+
+enum class FetchError { TIMEOUT, REFUSED };
+
+using Reply = std::variant<int, std::string, FetchError>;
+
+adt::Result<int, FetchError> fetch(int key) {
+  if (key < 0) {
+    return adt::Error(FetchError::REFUSED);
+  }
+  return adt::Ok(key * 2);
+}
+
+adt::Result<int, FetchError> fetch_sum(int first, int second) {
+  ADT_TRY_ASSIGN(const int a, fetch(first));
+  ADT_TRY_ASSIGN(const int b, fetch(second));
+  return adt::Ok(a + b);
+}
+
+void report_panic(const char *message) noexcept {
+  // Stands for a crash reporter: record, then end the process
+  std::printf("Panic handler: %s\n", message);
+  std::fflush(stdout);
+  std::_Exit(EXIT_SUCCESS);
+}
+
+int main() {
+  std::printf("Testing without exceptions and RTTI:\n");
+
+  const Reply replies[] = {Reply{7}, Reply{std::string("ok")},
+                           Reply{FetchError::TIMEOUT}};
+  for (const Reply &reply : replies) {
+    std::printf("Reply: %s\n",
+                adt::Inspect<std::string>(
+                    reply, [](int code) { return std::to_string(code); },
+                    [](const std::string &text) { return text; },
+                    [](FetchError) { return std::string("error"); })
+                    .c_str());
+  }
+
+  const std::variant<int, char> left = 'x';
+  const std::variant<int, char> right = 2;
+  std::printf("Pair: %d\n",
+              adt::Inspect<int>(
+                  left, right, [](char, int n) { return n; },
+                  [](const auto &, const auto &) { return -1; }));
+
+  const adt::Matcher<Reply, bool> is_error(
+      [](FetchError) { return true; }, [](const auto &) { return false; });
+  std::printf("Matcher: %d %d\n", is_error(replies[0]), is_error(replies[2]));
+
+  const adt::Result<int, FetchError> sum = fetch_sum(1, 2);
+  const adt::Result<int, FetchError> failed = fetch_sum(1, -2);
+  std::printf("Sum: %d, failed: %d\n", sum.value(),
+              failed.map([](int value) { return value + 1; }).has_value());
+
+  adt::Optional<int> cached = 5;
+  std::printf("Optional: %d\n",
+              adt::Inspect<int>(
+                  cached, [](int value) { return value; }, [] { return 0; }));
+
+  // Accessing the value of an error: no exception, the handler runs
+  adt::set_panic_handler(&report_panic);
+  std::printf("Value: %d\n", failed.value());
+  std::printf("the panic handler was not called\n");
+  return EXIT_FAILURE;
+}